@@ -56,8 +56,19 @@ __KERNEL_RCSID(0, "$NetBSD: libhfs.c,v 1.19 2023/08/11 05:51:34 mrg Exp $");
 
 #if !defined(_KERNEL) && !defined(_STANDALONE)
 #include <inttypes.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HFS_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__BYTE_ORDER__) && \
+	__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#include <arm_neon.h>
+#define HFS_SIMD_NEON
+#endif
 #endif /* !defined(_KERNEL) && defined(_STANDALONE) */
 
+/* segments gathered by hfslib_readd_with_extent_offsets() per readv batch */
+#define HFS_READ_SEGMENTS	64
+
 /* global private file/folder keys */
 hfs_catalog_key_t hfs_gMetadataDirectoryKey; /* contains HFS+ inodes */
 hfs_catalog_key_t hfs_gJournalInfoBlockFileKey;
@@ -185,6 +196,12 @@ hfslib_open_volume(
 
 	out_vol->readonly = in_readonly;
 	out_vol->offset = 0;
+	out_vol->catextents = NULL;
+	out_vol->extextents = NULL;
+	out_vol->attrextents = NULL;
+	out_vol->numcatextents = 0;
+	out_vol->numextextents = 0;
+	out_vol->numattrextents = 0;
 
 	if (hfslib_openvoldevice(out_vol, in_device, cbargs) != 0)
 		HFS_LIBERR("could not open device");
@@ -318,6 +335,30 @@ hfslib_open_volume(
 			HFS_LIBERR("could not parse attribute header node");
 	}
 
+	/*
+	 * Resolve the full extent lists of the B-tree files so that searches
+	 * don't have to. The extents overflow file must come first, as the
+	 * others may have spilled over into it. It can't have overflow extents
+	 * of its own, so resolving its extents never needs extextents, which
+	 * is only NULL until then.
+	 */
+	out_vol->numextextents = hfslib_get_file_extents(out_vol,
+	    HFS_CNID_EXTENTS, HFS_DATAFORK, &out_vol->extextents, cbargs);
+	if (out_vol->numextextents == 0)
+		HFS_LIBERR("could not locate extents overflow file extents");
+
+	out_vol->numcatextents = hfslib_get_file_extents(out_vol,
+	    HFS_CNID_CATALOG, HFS_DATAFORK, &out_vol->catextents, cbargs);
+	if (out_vol->numcatextents == 0)
+		HFS_LIBERR("could not locate catalog file extents");
+
+	if (out_vol->vh.attributes_file.extents[0].block_count > 0) {
+		out_vol->numattrextents = hfslib_get_file_extents(out_vol,
+		    HFS_CNID_ATTRIBUTES, HFS_DATAFORK, &out_vol->attrextents, cbargs);
+		if (out_vol->numattrextents == 0)
+			HFS_LIBERR("could not locate attributes file extents");
+	}
+
 	/*
 	 * Read the journal info block and journal header (if volume journaled).
 	 */
@@ -383,6 +424,19 @@ hfslib_close_volume(hfs_volume* in_vol, hfs_callback_args* cbargs)
 	if (in_vol == NULL)
 		return;
 	hfslib_closevoldevice(in_vol, cbargs);
+
+	if (in_vol->catextents != NULL)
+		hfslib_free(in_vol->catextents, cbargs);
+	if (in_vol->extextents != NULL)
+		hfslib_free(in_vol->extextents, cbargs);
+	if (in_vol->attrextents != NULL)
+		hfslib_free(in_vol->attrextents, cbargs);
+	in_vol->catextents = NULL;
+	in_vol->extextents = NULL;
+	in_vol->attrextents = NULL;
+	in_vol->numcatextents = 0;
+	in_vol->numextextents = 0;
+	in_vol->numattrextents = 0;
 }
 
 int
@@ -558,44 +612,44 @@ hfslib_find_catalog_record_with_key(
 	hfs_catalog_keyed_record_t* out_rec,
 	hfs_callback_args* cbargs)
 {
-	hfs_node_descriptor_t			nd = { .num_recs = 0 };
-	hfs_extent_descriptor_t*		extents;
-	hfs_catalog_keyed_record_t		lastrec;
+	hfs_node_view_t			view;
 	hfs_catalog_key_t*	curkey;
-	void**				recs;
+	hfs_catalog_key_t*	searchkey;
 	void*				buffer;
-	uint64_t			bytesread;
 	uint32_t			curnode;
-	uint16_t*			recsizes;
-	uint16_t			numextents;
-	uint16_t			recnum;
+	uint32_t			bufnode;
 	int16_t				leaftype;
 	int					keycompare;
+	int					recnum;
 	int					result;
+	int					(*keycmp)(const void*, const void*);
 
 	if (in_key == NULL || out_rec == NULL || in_vol == NULL)
 		return 1;
 
 	result = 1;
 	buffer = NULL;
+	bufnode = 0;
 	curkey = NULL;
-	extents = NULL;
-	recs = NULL;
-	recsizes = NULL;
 
 	/* The key takes up over half a kb of ram, which is a lot for the BSD
 	 * kernel stack. So allocate it in the heap instead to play it safe. */
-	curkey = hfslib_malloc(sizeof(hfs_catalog_key_t), cbargs);
+	curkey = hfslib_malloc(2 * sizeof(hfs_catalog_key_t), cbargs);
 	if (curkey == NULL)
 		HFS_LIBERR("could not allocate catalog search key");
 
-	buffer = hfslib_malloc(in_vol->chr.node_size, cbargs);
-	if (buffer == NULL)
-		HFS_LIBERR("could not allocate node buffer");
+	/* Every record on the way down is compared against the same key, so on
+	 * case folding volumes fold it once here rather than at each step. */
+	if (in_vol->keycmp == hfslib_compare_catalog_keys_cf) {
+		searchkey = curkey + 1;
+		hfslib_fold_catalog_key(in_key, searchkey);
+		keycmp = hfslib_compare_catalog_keys_cf_folded;
+	} else {
+		searchkey = in_key;
+		keycmp = NULL;
+	}
 
-	numextents = hfslib_get_file_extents(in_vol, HFS_CNID_CATALOG,
-		HFS_DATAFORK, &extents, cbargs);
-	if (numextents == 0)
+	if (in_vol->catextents == NULL)
 		HFS_LIBERR("could not locate fork extents");
 
 	curnode = in_vol->chr.root_node;
@@ -606,87 +660,62 @@ hfslib_find_catalog_record_with_key(
 	printf("\n");
 #endif
 
-	do {
+	while (1) {
 #ifdef DLO_DEBUG
 		printf("--> node %d\n", curnode);
 #endif
 
-		if (hfslib_readd_with_extents(in_vol, buffer, 
-			&bytesread,in_vol->chr.node_size, curnode * in_vol->chr.node_size, 
-			extents, numextents, cbargs) != 0)
+		if (hfslib_get_node(in_vol, HFS_CATALOG_FILE, curnode,
+			in_vol->catextents, in_vol->numcatextents, &buffer, cbargs) != 0)
 			HFS_LIBERR("could not read catalog node #%i", curnode);
+		bufnode = curnode;
 
-		if (hfslib_reada_node(buffer, &nd, &recs, &recsizes, HFS_CATALOG_FILE,
-			in_vol, cbargs) == 0)
+		if (hfslib_read_node_view(buffer, HFS_CATALOG_FILE, in_vol,
+			&view) != 0)
 			HFS_LIBERR("could not parse catalog node #%i", curnode);
 
-		for (recnum = 0; recnum < nd.num_recs; recnum++)
-		{
-			leaftype = nd.kind;
-			if (hfslib_read_catalog_keyed_record(recs[recnum], out_rec,
-				&leaftype, curkey, in_vol) == 0)
-				HFS_LIBERR("could not read catalog record #%i",recnum);
+		if (view.nd.kind != HFS_INDEXNODE && view.nd.kind != HFS_LEAFNODE)
+			HFS_LIBERR("unexpected kind for catalog node #%i", curnode);
 
-#ifdef DLO_DEBUG
-			printf("---> record %d: ", recnum);
-			dlo_print_key(curkey);
-			fflush(stdout);
-#endif
-			keycompare = in_vol->keycmp(in_key, curkey);
-#ifdef DLO_DEBUG
-			printf(" %c\n",
-			       keycompare < 0 ? '<'
-			       : keycompare == 0 ? '=' : '>');
-#endif
+		recnum = hfslib_search_node(in_vol, &view, searchkey, keycmp, curkey,
+			&keycompare);
+		if (recnum == -2)
+			HFS_LIBERR("could not read catalog node #%i records", curnode);
 
-			if (keycompare < 0) {
-				/* Check if key is less than *every* record, which should never
-				 * happen if the volume is consistent and the key legit. */
-				if (recnum == 0)
-					HFS_LIBERR("all records greater than key");
-
-				/* Otherwise, we've found the first record that exceeds our key,
-				 * so retrieve the previous record, which is still less... */
-				memcpy(out_rec, &lastrec,
-					sizeof(hfs_catalog_keyed_record_t));
-
-				/* ...unless this is a leaf node, which means we've gone from
-				 * a key which is smaller than the search key, in the previous
-				 * loop, to a key which is larger, in this loop, and that
-				 * implies that our search key does not exist on the volume. */
-				if (nd.kind == HFS_LEAFNODE)
-					result = -1;
-				break;
-			} else if (keycompare == 0) {
-				/* If leaf node, found an exact match. */
-				result = 0;
-				break;
-			} else if (recnum == nd.num_recs-1 && keycompare > 0) {
-				/* If leaf node, we've reached the last record with no match,
-				 * which means this key is not present on the volume. */
-				result = -1;
-				break;
-			}
+		/* Check if key is less than *every* record, which should never
+		 * happen if the volume is consistent and the key legit. */
+		if (recnum == -1)
+			HFS_LIBERR("all records greater than key");
 
-			memcpy(&lastrec, out_rec, sizeof(hfs_catalog_keyed_record_t));
+		/* Only the record we end up on is decoded in full: the child
+		 * pointer of the last index record not exceeding the key, or the
+		 * matching leaf record. */
+		if (view.nd.kind == HFS_LEAFNODE && keycompare != 0) {
+			result = -1;
+			break;
 		}
 
-		if (nd.kind == HFS_INDEXNODE)
-			curnode = out_rec->child;
-		else if (nd.kind == HFS_LEAFNODE)
+		leaftype = view.nd.kind;
+		if (hfslib_read_catalog_keyed_record(
+			hfslib_get_node_record(&view, recnum, NULL), out_rec,
+			&leaftype, curkey, in_vol) == 0)
+			HFS_LIBERR("could not read catalog record #%i", recnum);
+
+		if (view.nd.kind == HFS_LEAFNODE) {
+			result = 0;
 			break;
-		hfslib_free_recs(&recs, &recsizes, &nd.num_recs, cbargs);
-	} while (nd.kind != HFS_LEAFNODE);
+		}
+
+		curnode = out_rec->child;
+		hfslib_release_node(in_vol, HFS_CATALOG_FILE, bufnode, buffer, cbargs);
+		buffer = NULL;
+	}
 
 	/* FALLTHROUGH */
 error:
-	if (extents != NULL)
-		hfslib_free(extents, cbargs);
-	hfslib_free_recs(&recs, &recsizes, &nd.num_recs, cbargs);
 	if (curkey != NULL)
 		hfslib_free(curkey, cbargs);		
-	if (buffer != NULL)
-		hfslib_free(buffer, cbargs);
+	hfslib_release_node(in_vol, HFS_CATALOG_FILE, bufnode, buffer, cbargs);
 	return result;
 }
 
@@ -699,18 +728,13 @@ hfslib_find_extent_record_with_key(hfs_volume* in_vol,
 	hfs_extent_record_t* out_rec,
 	hfs_callback_args* cbargs)
 {
-	hfs_node_descriptor_t		nd = { .num_recs = 0 };
-	hfs_extent_descriptor_t*	extents;
-	hfs_extent_record_t		lastrec;
+	hfs_node_view_t		view;
 	hfs_extent_key_t	curkey;
-	void**				recs;
 	void*				buffer;
-	uint64_t			bytesread;
 	uint32_t			curnode;
-	uint16_t*			recsizes;
-	uint16_t			numextents;
-	uint16_t			recnum;
+	uint32_t			bufnode;
 	int					keycompare;
+	int					recnum;
 	int					result;
 	
 	if (in_vol == NULL || in_key == NULL || out_rec == NULL)
@@ -718,72 +742,56 @@ hfslib_find_extent_record_with_key(hfs_volume* in_vol,
 
 	result = 1;
 	buffer = NULL;
-	extents = NULL;
-	recs = NULL;
-	recsizes = NULL;
-
-	buffer = hfslib_malloc(in_vol->ehr.node_size, cbargs);
-	if (buffer == NULL)
-		HFS_LIBERR("could not allocate node buffer");
+	bufnode = 0;
 
-	numextents = hfslib_get_file_extents(in_vol, HFS_CNID_EXTENTS,
-		HFS_DATAFORK, &extents, cbargs);
-	if (numextents == 0)
+	/* see hfslib_open_volume */
+	if (in_vol->extextents == NULL)
 		HFS_LIBERR("could not locate fork extents");
 
-	nd.num_recs = 0;
 	curnode = in_vol->ehr.root_node;
 
-	do {
-		hfslib_free_recs(&recs, &recsizes, &nd.num_recs, cbargs);
-		recnum = 0;
-
-		if (hfslib_readd_with_extents(in_vol, buffer, &bytesread, 
-			in_vol->ehr.node_size, curnode * in_vol->ehr.node_size, extents, 
-			numextents, cbargs) != 0)
+	while (1) {
+		if (hfslib_get_node(in_vol, HFS_EXTENTS_FILE, curnode,
+			in_vol->extextents, in_vol->numextextents, &buffer, cbargs) != 0)
 			HFS_LIBERR("could not read extents overflow node #%i", curnode);
+		bufnode = curnode;
 
-		if (hfslib_reada_node(buffer, &nd, &recs, &recsizes, HFS_EXTENTS_FILE,
-			in_vol, cbargs) == 0)
+		if (hfslib_read_node_view(buffer, HFS_EXTENTS_FILE, in_vol,
+			&view) != 0)
 			HFS_LIBERR("could not parse extents overflow node #%i",curnode);
 
-		for (recnum = 0; recnum < nd.num_recs; recnum++) {
-			memcpy(&lastrec, out_rec, sizeof(hfs_extent_record_t));
+		if (view.nd.kind != HFS_INDEXNODE && view.nd.kind != HFS_LEAFNODE)
+		    HFS_LIBERR("unknown node type for extents overflow node #%i",curnode);
 
-			if (hfslib_read_extent_record(recs[recnum], out_rec, nd.kind,
-				&curkey, in_vol) == 0)
-				HFS_LIBERR("could not read extents record #%i",recnum);
+		recnum = hfslib_search_node(in_vol, &view, in_key, NULL, &curkey,
+			&keycompare);
+		if (recnum == -2)
+			HFS_LIBERR("could not read extents overflow node #%i records",
+				curnode);
 
-			keycompare = hfslib_compare_extent_keys(in_key, &curkey);
-			if (keycompare < 0) {
-				/* this should never happen for any legitimate key */
-				if (recnum == 0)
-					return 1;
-				memcpy(out_rec, &lastrec, sizeof(hfs_extent_record_t));
-				break;
-			} else if (keycompare == 0 ||
-			    (recnum == nd.num_recs-1 && keycompare > 0))
-				break;
-		}
-		
-		if (nd.kind == HFS_INDEXNODE)
-			curnode = *((uint32_t *)out_rec); /* out_rec is a node ptr in this case */
-		else if (nd.kind == HFS_LEAFNODE)
+		/* this should never happen for any legitimate key */
+		if (recnum == -1)
+			goto error;
+
+		if (hfslib_read_extent_record(
+			hfslib_get_node_record(&view, recnum, NULL), out_rec,
+			view.nd.kind, &curkey, in_vol) == 0)
+			HFS_LIBERR("could not read extents record #%i",recnum);
+
+		if (view.nd.kind == HFS_LEAFNODE)
 			break;
-		else
-		    HFS_LIBERR("unknown node type for extents overflow node #%i",curnode);
-	} while (nd.kind != HFS_LEAFNODE);
+
+		curnode = *((uint32_t *)out_rec); /* out_rec is a node ptr in this case */
+		hfslib_release_node(in_vol, HFS_EXTENTS_FILE, bufnode, buffer, cbargs);
+		buffer = NULL;
+	}
 
 	result = 0;
 
 	/* FALLTHROUGH */
 
 error:
-	if (buffer != NULL)
-		hfslib_free(buffer, cbargs);
-	if (extents != NULL)
-		hfslib_free(extents, cbargs);
-	hfslib_free_recs(&recs, &recsizes, &nd.num_recs, cbargs);
+	hfslib_release_node(in_vol, HFS_EXTENTS_FILE, bufnode, buffer, cbargs);
 	return result;	
 }
 
@@ -795,25 +803,14 @@ hfslib_get_file_extents(hfs_volume* in_vol,
 	hfs_extent_descriptor_t** out_extents,
 	hfs_callback_args* cbargs)
 {
-	hfs_extent_descriptor_t*	dummy;
-	hfs_extent_key_t		extentkey;
 	hfs_catalog_keyed_record_t filerec;
 	hfs_catalog_key_t		filekey;
 	hfs_thread_record_t	fileparent;
 	hfs_fork_t		fork = {.logical_size = 0};
-	hfs_extent_record_t	nextextentrec;
-	uint32_t	numblocks;
-	uint16_t	numextents, n;
 
 	if (in_vol == NULL || in_cnid == 0)
 		return 0;
 
-	if (out_extents != NULL) {
-		*out_extents = hfslib_malloc(sizeof(hfs_extent_descriptor_t), cbargs);
-		if (*out_extents == NULL)
-			return 0;
-	}
-
 	switch(in_cnid)
 	{
 		case HFS_CNID_CATALOG:
@@ -859,50 +856,216 @@ hfslib_get_file_extents(hfs_volume* in_vol,
 				fork = filerec.file.rsrc_fork;
 	}
 
+	return hfslib_get_fork_extents(in_vol, in_cnid, in_forktype, &fork,
+	    out_extents, cbargs);
+
+error:
+	if (out_extents != NULL)
+		*out_extents = NULL;
+	return 0;
+}
+
+/*
+ * Appends the extents of in_rec up to its first empty one to *inout_extents,
+ * growing it geometrically, or only counts them if inout_extents is NULL.
+ *
+ * Returns the number of extents appended, or -1 on error.
+ */
+static int
+hfslib_append_extent_record(hfs_cnid_t in_cnid,
+	const hfs_extent_record_t in_rec,
+	hfs_extent_descriptor_t** inout_extents,
+	uint16_t* inout_numextents,
+	uint32_t* inout_capacity,
+	uint32_t* inout_numblocks,
+	hfs_callback_args* cbargs)
+{
+	hfs_extent_descriptor_t*	dummy;
+	uint32_t	capacity;
+	uint16_t	n;
+
+	for (n = 0; n < 8; n++) {
+		if (in_rec[n].block_count == 0)
+			break;
+
+		if (UINT32_MAX - *inout_numblocks < in_rec[n].block_count)
+			HFS_LIBERR("block count overflow for CNID %" PRIu32
+				", record #%" PRIu16 " count %" PRIu32, in_cnid, n,
+				in_rec[n].block_count);
+
+		*inout_numblocks += in_rec[n].block_count;
+	}
+
+	if (UINT16_MAX - *inout_numextents < n)
+		HFS_LIBERR("too many extents for CNID %" PRIu32, in_cnid);
+
+	if (inout_extents != NULL) {
+		if (*inout_numextents + n > *inout_capacity) {
+			capacity = *inout_capacity * 2;
+			if (capacity < *inout_numextents + n)
+				capacity = *inout_numextents + n;
+			dummy = hfslib_realloc(*inout_extents,
+			    capacity * sizeof(hfs_extent_descriptor_t), cbargs);
+			if (dummy == NULL)
+				HFS_LIBERR("could not allocate extents for CNID %" PRIu32,
+					in_cnid);
+			*inout_extents = dummy;
+			*inout_capacity = capacity;
+		}
+
+		memcpy(*inout_extents + *inout_numextents, in_rec,
+		    n * sizeof(hfs_extent_descriptor_t));
+	}
+	*inout_numextents += n;
+
+	return n;
+
+error:
+	return -1;
+}
+
+/*
+ * out_extents may be NULL.
+ *
+ * The same as hfslib_get_file_extents, for a fork whose catalog record the
+ * caller already holds. Only forks with more than the eight extents in their
+ * record need the extents overflow file. Their overflow records are keyed by
+ * the fork's CNID, type and starting block and so sort together, so they are
+ * gathered by descending the tree once to the first and following the leaf
+ * chain from there.
+ */
+uint16_t
+hfslib_get_fork_extents(hfs_volume* in_vol,
+	hfs_cnid_t in_cnid,
+	uint8_t in_forktype,
+	const hfs_fork_t* in_fork,
+	hfs_extent_descriptor_t** out_extents,
+	hfs_callback_args* cbargs)
+{
+	hfs_node_view_t		view;
+	hfs_extent_key_t	extentkey;
+	hfs_extent_key_t	curkey;
+	hfs_extent_record_t	nextextentrec;
+	void*		buffer;
+	uint32_t	numblocks, capacity, curnode, bufnode, nodes_visited;
+	uint16_t	numextents;
+	int		recnum, cmp, inleaves;
+
+	if (in_vol == NULL || in_fork == NULL)
+		return 0;
+
+	buffer = NULL;
+	bufnode = 0;
 	numextents = 0;
 	numblocks = 0;
-	memcpy(&nextextentrec, &fork.extents, sizeof(hfs_extent_record_t));
+	capacity = 8;
 
-	while (1) {
-		for (n = 0; n < 8; n++) {
-			if (nextextentrec[n].block_count == 0)
-				break;
+	if (out_extents != NULL) {
+		*out_extents = hfslib_malloc(
+		    capacity * sizeof(hfs_extent_descriptor_t), cbargs);
+		if (*out_extents == NULL)
+			return 0;
+	}
+
+	if (hfslib_append_extent_record(in_cnid, in_fork->extents, out_extents,
+		&numextents, &capacity, &numblocks, cbargs) < 0)
+		goto error;
+
+	if (numblocks >= in_fork->total_blocks)
+		goto exit;
+
+	/* see hfslib_open_volume */
+	if (in_vol->extextents == NULL)
+		HFS_LIBERR("could not locate fork extents");
 
-			if (UINT32_MAX - numblocks < nextextentrec[n].block_count)
-				HFS_LIBERR("block count overflow for CNID %" PRIu32
-					", record #%" PRIu16 " count %" PRIu32, in_cnid, n,
-					nextextentrec[n].block_count);
+	if (hfslib_make_extent_key(in_cnid, in_forktype, numblocks,
+		&extentkey) == 0)
+		goto error;
 
-			numblocks += nextextentrec[n].block_count;
+	curnode = in_vol->ehr.root_node;
+	inleaves = 0;
+
+	for (nodes_visited = 0; curnode != 0 &&
+		nodes_visited < in_vol->ehr.total_nodes; nodes_visited++) {
+		if (hfslib_get_node(in_vol, HFS_EXTENTS_FILE, curnode,
+			in_vol->extextents, in_vol->numextextents, &buffer, cbargs) != 0)
+			HFS_LIBERR("could not read extents overflow node #%" PRIu32,
+				curnode);
+		bufnode = curnode;
+
+		if (hfslib_read_node_view(buffer, HFS_EXTENTS_FILE, in_vol,
+			&view) != 0)
+			HFS_LIBERR("could not parse extents overflow node #%" PRIu32,
+				curnode);
+
+		if (view.nd.kind != HFS_INDEXNODE && view.nd.kind != HFS_LEAFNODE)
+			HFS_LIBERR("unknown node type for extents overflow node #%"
+				PRIu32, curnode);
+
+		/* leaf nodes reached through the chain are scanned from the start */
+		if (inleaves) {
+			if (view.nd.kind != HFS_LEAFNODE)
+				HFS_LIBERR("extents overflow node #%" PRIu32
+					" is not a leaf", curnode);
+			recnum = 0;
+		} else {
+			recnum = hfslib_search_node(in_vol, &view, &extentkey, NULL,
+				&curkey, &cmp);
+			if (recnum == -2)
+				HFS_LIBERR("could not read extents overflow node #%" PRIu32
+					" records", curnode);
+			if (recnum == -1)
+				HFS_LIBERR("no overflow extents for CNID %" PRIu32,
+					in_cnid);
 		}
-		if (out_extents != NULL) {
-			dummy = hfslib_realloc(*out_extents,
-			    (numextents+n) * sizeof(hfs_extent_descriptor_t),
-			    cbargs);
-			if (dummy == NULL)
-				goto error;
-			*out_extents = dummy;
 
-			memcpy(*out_extents + numextents,
-			    &nextextentrec, n*sizeof(hfs_extent_descriptor_t));
+		if (view.nd.kind == HFS_INDEXNODE) {
+			if (hfslib_read_extent_record(
+				hfslib_get_node_record(&view, recnum, NULL),
+				&nextextentrec, view.nd.kind, &curkey, in_vol) == 0)
+				HFS_LIBERR("could not read extents record #%i", recnum);
+
+			/* nextextentrec is a node ptr in this case */
+			curnode = *((uint32_t *)&nextextentrec);
+			hfslib_release_node(in_vol, HFS_EXTENTS_FILE, bufnode, buffer,
+				cbargs);
+			buffer = NULL;
+			continue;
 		}
-		numextents += n;
 
-		if (numblocks >= fork.total_blocks)
-			break;
+		inleaves = 1;
+		for (; recnum < view.nd.num_recs; recnum++) {
+			if (hfslib_read_extent_record(
+				hfslib_get_node_record(&view, recnum, NULL),
+				&nextextentrec, view.nd.kind, &curkey, in_vol) == 0)
+				HFS_LIBERR("could not read extents record #%i", recnum);
+
+			/* each record must pick up where the previous one ended */
+			if (curkey.file_cnid != in_cnid ||
+				curkey.fork_type != in_forktype ||
+				curkey.start_block != numblocks)
+				HFS_LIBERR("missing overflow extents for CNID %" PRIu32
+					" at block %" PRIu32, in_cnid, numblocks);
+
+			if (hfslib_append_extent_record(in_cnid, nextextentrec,
+				out_extents, &numextents, &capacity, &numblocks,
+				cbargs) <= 0)
+				goto error;
 
-		if (hfslib_make_extent_key(in_cnid, in_forktype, numblocks,
-			&extentkey) == 0)
-			goto error;
+			if (numblocks >= in_fork->total_blocks)
+				goto exit;
+		}
 
-		if (hfslib_find_extent_record_with_key(in_vol, &extentkey,
-			&nextextentrec, cbargs) != 0)
-			goto error;
+		curnode = view.nd.flink;
+		hfslib_release_node(in_vol, HFS_EXTENTS_FILE, bufnode, buffer, cbargs);
+		buffer = NULL;
 	}
 
-	goto exit;
-	
+	HFS_LIBERR("missing overflow extents for CNID %" PRIu32 " at block %"
+		PRIu32, in_cnid, numblocks);
+
 error:
+	hfslib_release_node(in_vol, HFS_EXTENTS_FILE, bufnode, buffer, cbargs);
 	if (out_extents != NULL && *out_extents != NULL) {
 		hfslib_free(*out_extents, cbargs);
 		*out_extents = NULL;
@@ -910,6 +1073,7 @@ error:
 	return 0;
 
 exit:
+	hfslib_release_node(in_vol, HFS_EXTENTS_FILE, bufnode, buffer, cbargs);
 	return numextents;
 }
 
@@ -1012,154 +1176,260 @@ hfslib_find_attribute_record_with_key(hfs_volume* in_vol,
 	hfs_attribute_key_t* in_key, hfs_attribute_record_t* out_record,
 	void** out_inline_data, hfs_callback_args* cbargs)
 {
-	hfs_node_descriptor_t nd;
-	hfs_extent_descriptor_t* extents;
+	hfs_attribute_cursor_t cursor;
+	int result;
+
+	memset(&cursor, 0, sizeof(cursor));
+	result = hfslib_find_attribute_record_near(in_vol, &cursor, in_key,
+		out_record, out_inline_data, cbargs);
+	hfslib_close_attribute_cursor(in_vol, &cursor, cbargs);
+
+	return result;
+}
+
+/*
+ * compare in_key against the keys of the first and last records of an
+ * attributes leaf: out_cmp is set to -1 if in_key sorts before the leaf, 1 if
+ * it sorts after it and 0 if it falls within it
+ */
+static int
+hfslib_compare_attribute_leaf(hfs_volume* in_vol,
+	const hfs_node_view_t* in_view, const hfs_attribute_key_t* in_key,
+	hfs_attribute_key_t* out_scratch_key, int* out_cmp)
+{
+	void* rec;
+	uint16_t recsize;
+
+	*out_cmp = 0;
+	if (in_view->nd.num_recs == 0)
+		return 1;
+
+	rec = hfslib_get_node_record(in_view, 0, &recsize);
+	if (hfslib_read_attribute_record(rec, recsize, HFS_LEAFNODE, NULL,
+		out_scratch_key, NULL, in_vol) == 0)
+		return 1;
+	if (hfslib_compare_attribute_keys(in_key, out_scratch_key) < 0) {
+		*out_cmp = -1;
+		return 0;
+	}
+
+	rec = hfslib_get_node_record(in_view, in_view->nd.num_recs - 1,
+		&recsize);
+	if (hfslib_read_attribute_record(rec, recsize, HFS_LEAFNODE, NULL,
+		out_scratch_key, NULL, in_vol) == 0)
+		return 1;
+	if (hfslib_compare_attribute_keys(in_key, out_scratch_key) > 0)
+		*out_cmp = 1;
+
+	return 0;
+}
+
+/*
+ * hfslib_find_attribute_record_near()
+ *
+ * Looks up a single extended attribute matching in_key like
+ * hfslib_find_attribute_record_with_key(), but keeps the leaf node the search
+ * ended in held by inout_cursor for the next lookup. If the next key falls
+ * within that leaf or the one following it, it is found there without
+ * descending the tree again, so looking up many keys in ascending order
+ * (e.g. the same attribute for a sorted list of CNIDs) reads each leaf once.
+ *
+ * inout_cursor must be zeroed before its first use and closed with
+ * hfslib_close_attribute_cursor() once the caller is done with it.
+ *
+ * Returns 0 if the attribute was found, 1 if not or on error.
+ */
+int
+hfslib_find_attribute_record_near(hfs_volume* in_vol,
+	hfs_attribute_cursor_t* inout_cursor, hfs_attribute_key_t* in_key,
+	hfs_attribute_record_t* out_record, void** out_inline_data,
+	hfs_callback_args* cbargs)
+{
 	hfs_attribute_record_t record;
 	hfs_attribute_key_t* curkey;
-	void** recs;
-	void* node;
+	void* rec;
 	void* inlinedata;
-	uint64_t bytesread;
 	uint32_t curnode;
-	uint16_t* recsizes;
-	uint16_t level, numextents, recnum;
-	int result, cmp;
+	uint16_t level, recsize;
+	int recnum, result, cmp;
 
 	if (out_record)
 		out_record->type = 0;
 	if (out_inline_data)
 		*out_inline_data = NULL;
 
-	if (in_key == NULL || out_record == NULL || in_vol == NULL)
+	if (in_key == NULL || out_record == NULL || in_vol == NULL ||
+		inout_cursor == NULL)
 		return 1;
 
-	result = 1;
-	extents = NULL;
-	recs = NULL;
-	recsizes = NULL;
-	node = NULL;
-	nd.num_recs = 0;
-
 	/* Not all volumes have an attributes file */
 	if (in_vol->vh.attributes_file.extents[0].block_count == 0 ||
 		in_vol->ahr.leaf_recs == 0 ||
 		in_vol->ahr.tree_depth == 0)
 		return 1;
 
+	result = 1;
+
 	curkey = hfslib_malloc(sizeof(hfs_attribute_key_t), cbargs);
 	if (curkey == NULL)
 		HFS_LIBERR("could not allocate attributes search key");
 
-	node = hfslib_malloc(in_vol->ahr.node_size, cbargs);
-	if (node == NULL)
-		HFS_LIBERR("could not allocate attributes file node buffer");
+	if (in_vol->attrextents == NULL)
+		HFS_LIBERR("could not locate attributes file extents");
 
-	curnode = in_vol->ahr.root_node;
+	if (inout_cursor->buffer != NULL) {
+		if (hfslib_compare_attribute_leaf(in_vol, &inout_cursor->view,
+			in_key, curkey, &cmp) != 0)
+			HFS_LIBERR("could not read attribute node #%" PRIu32 " records",
+				inout_cursor->node);
 
-	numextents = hfslib_get_file_extents(in_vol, HFS_CNID_ATTRIBUTES,
-		HFS_DATAFORK, &extents, NULL);
-	if (numextents == 0)
-		HFS_LIBERR("could not locate attributes file extents");
+		/*
+		 * a key past the end of the held leaf is most likely in the next
+		 * one, and if it sorts before that one there's no match at all
+		 */
+		if (cmp > 0 && inout_cursor->view.nd.flink == 0)
+			goto error;
+		if (cmp > 0) {
+			curnode = inout_cursor->view.nd.flink;
+			hfslib_close_attribute_cursor(in_vol, inout_cursor, cbargs);
+
+			if (hfslib_get_node(in_vol, HFS_ATTRIBUTES_FILE, curnode,
+				in_vol->attrextents, in_vol->numattrextents,
+				&inout_cursor->buffer, cbargs) != 0)
+				HFS_LIBERR("could not read attribute node #%" PRIu32,
+					curnode);
+			inout_cursor->node = curnode;
+
+			if (hfslib_read_node_view(inout_cursor->buffer,
+				HFS_ATTRIBUTES_FILE, in_vol, &inout_cursor->view) != 0 ||
+				inout_cursor->view.nd.kind != HFS_LEAFNODE)
+				HFS_LIBERR("could not parse attribute node #%" PRIu32,
+					curnode);
+
+			if (hfslib_compare_attribute_leaf(in_vol, &inout_cursor->view,
+				in_key, curkey, &cmp) != 0)
+				HFS_LIBERR("could not read attribute node #%" PRIu32
+					" records", curnode);
+
+			if (cmp < 0)
+				goto error;
+		}
+		if (cmp == 0)
+			goto leaf;
+
+		hfslib_close_attribute_cursor(in_vol, inout_cursor, cbargs);
+	}
+
+	curnode = in_vol->ahr.root_node;
 
 	for (level = 0; level < in_vol->ahr.tree_depth && curnode != 0; level++) {
-		if (hfslib_readd_with_extents(in_vol, node,
-			&bytesread,in_vol->ahr.node_size, curnode * in_vol->ahr.node_size,
-			extents, numextents, cbargs) != 0)
+		if (hfslib_get_node(in_vol, HFS_ATTRIBUTES_FILE, curnode,
+			in_vol->attrextents, in_vol->numattrextents,
+			&inout_cursor->buffer, cbargs) != 0)
 			HFS_LIBERR("could not read attribute node #%" PRIu32, curnode);
+		inout_cursor->node = curnode;
 
-		if (hfslib_reada_node(node, &nd, &recs, &recsizes, HFS_ATTRIBUTES_FILE,
-			in_vol, cbargs) == 0)
+		if (hfslib_read_node_view(inout_cursor->buffer, HFS_ATTRIBUTES_FILE,
+			in_vol, &inout_cursor->view) != 0)
 			HFS_LIBERR("could not parse attribute node #%" PRIu32, curnode);
 
-		if ((level < in_vol->ahr.tree_depth - 1 && nd.kind != HFS_INDEXNODE) ||
-			(level == in_vol->ahr.tree_depth - 1 && nd.kind != HFS_LEAFNODE))
+		if ((level < in_vol->ahr.tree_depth - 1 &&
+			inout_cursor->view.nd.kind != HFS_INDEXNODE) ||
+			(level == in_vol->ahr.tree_depth - 1 &&
+			inout_cursor->view.nd.kind != HFS_LEAFNODE))
 			HFS_LIBERR("attribute node kind unexpected at depth %" PRIu16 " #%"
 				PRIu32, level, curnode);
 
-		for (recnum = 0, curnode = 0; recnum < nd.num_recs && curnode == 0;
-			recnum++) {
+		if (inout_cursor->view.nd.kind == HFS_LEAFNODE)
+			goto leaf;
 
-			if (hfslib_read_attribute_record(recs[recnum], recsizes[recnum],
-				nd.kind, NULL, curkey, NULL, in_vol) == 0)
-				HFS_LIBERR("could not read attribute record #%" PRIu16, recnum);
+		recnum = hfslib_search_node(in_vol, &inout_cursor->view, in_key, NULL,
+			curkey, &cmp);
+		if (recnum == -2)
+			HFS_LIBERR("could not read attribute node #%" PRIu32 " records",
+				curnode);
 
-			cmp = hfslib_compare_attribute_keys(in_key, curkey);
+		/*
+		 * if the first record in the first index node is greater than our
+		 * search key there's no matching xattr
+		 */
+		if (recnum == -1)
+			break;
 
-			if (cmp < 0) {
-				if (recnum > 0 && nd.kind == HFS_INDEXNODE) {
-					/* might be in the previous node */
-					if (hfslib_read_attribute_record(recs[recnum - 1],
-						recsizes[recnum - 1], nd.kind, &record, NULL, NULL,
-						in_vol) == 0)
-						HFS_LIBERR("could not read attribute record #%"
-							PRIu16, recnum);
+		/* descend into the last index not greater than our key */
+		rec = hfslib_get_node_record(&inout_cursor->view, recnum, &recsize);
+		if (hfslib_read_attribute_record(rec, recsize, HFS_INDEXNODE, &record,
+			NULL, NULL, in_vol) == 0)
+			HFS_LIBERR("could not read attribute record #%d", recnum);
 
-					curnode = record.child_node;
-				}
+		curnode = record.child_node;
+		hfslib_close_attribute_cursor(in_vol, inout_cursor, cbargs);
+	}
 
-				/*
-				 * otherwise the first record in the first index node is greater
-				 * than our search key, or we reached the end of a leaf node and
-				 * found nothing. either way we're done, there's no matching
-				 * xattr
-				 */
-			} else if ((cmp == 0 || recnum == nd.num_recs - 1) &&
-				nd.kind == HFS_INDEXNODE) {
+	/* no leaf found */
+	hfslib_close_attribute_cursor(in_vol, inout_cursor, cbargs);
+	goto error;
 
-				/*
-				 * either an exact match or we've reached the end of the node
-				 * and didn't find anything. either way descend into this index
-				 */
-				if (hfslib_read_attribute_record(recs[recnum], recsizes[recnum],
-					nd.kind, &record, NULL, NULL, in_vol) == 0)
-					HFS_LIBERR("could not read attribute record #%" PRIu16,
-						recnum);
+leaf:
+	recnum = hfslib_search_node(in_vol, &inout_cursor->view, in_key, NULL,
+		curkey, &cmp);
+	if (recnum == -2)
+		HFS_LIBERR("could not read attribute node #%" PRIu32 " records",
+			inout_cursor->node);
 
-				curnode = record.child_node;
-			} else if (cmp == 0) {
-				/* found the xattr */
-				if (hfslib_read_attribute_record(recs[recnum], recsizes[recnum],
-					nd.kind, &record, NULL, &inlinedata, in_vol) == 0)
-					HFS_LIBERR("could not read attribute record #%" PRIu16,
-						recnum);
+	/* the leaf has no exact match, so there's no matching xattr */
+	if (recnum == -1 || cmp != 0)
+		goto error;
 
-				memcpy(out_record, &record, sizeof(record));
+	rec = hfslib_get_node_record(&inout_cursor->view, recnum, &recsize);
+	if (hfslib_read_attribute_record(rec, recsize, HFS_LEAFNODE, &record,
+		NULL, &inlinedata, in_vol) == 0)
+		HFS_LIBERR("could not read attribute record #%d", recnum);
 
-				/*
-				 * any inline data attrs are in the node buffer that we're about
-				 * to free. allocate a buffer with just the attribute which the
-				 * caller can manage.
-				 */
-				if (out_inline_data && inlinedata &&
-					record.inline_record.length) {
-					*out_inline_data = hfslib_malloc(
-						record.inline_record.length, cbargs);
+	memcpy(out_record, &record, sizeof(record));
 
-					if (*out_inline_data == NULL)
-						HFS_LIBERR("couldn't allocate attribute data #%"
-							PRIu16, recnum);
+	/*
+	 * any inline data attrs are in the node buffer which the cursor will let
+	 * go of. allocate a buffer with just the attribute which the caller can
+	 * manage.
+	 */
+	if (out_inline_data && inlinedata && record.inline_record.length) {
+		*out_inline_data = hfslib_malloc(record.inline_record.length, cbargs);
 
-					memcpy(*out_inline_data, inlinedata,
-						record.inline_record.length);
-				}
+		if (*out_inline_data == NULL)
+			HFS_LIBERR("couldn't allocate attribute data #%d", recnum);
 
-				result = 0;
-				break;
-			}
-			/* continue on to the next record */
-		}
-		hfslib_free_recs(&recs, &recsizes, &nd.num_recs, cbargs);
+		memcpy(*out_inline_data, inlinedata, record.inline_record.length);
 	}
 
+	result = 0;
+
 error:
-	hfslib_free(extents, cbargs);
-	hfslib_free_recs(&recs, &recsizes, &nd.num_recs, cbargs);
 	hfslib_free(curkey, cbargs);
-	hfslib_free(node, cbargs);
 
 	return result;
 }
 
+/*
+ * hfslib_close_attribute_cursor()
+ *
+ * Releases the leaf node held by in_cursor, if any.
+ */
+void
+hfslib_close_attribute_cursor(
+	hfs_volume* in_vol,
+	hfs_attribute_cursor_t* in_cursor,
+	hfs_callback_args* cbargs)
+{
+	if (in_cursor == NULL)
+		return;
+
+	hfslib_release_node(in_vol, HFS_ATTRIBUTES_FILE, in_cursor->node,
+		in_cursor->buffer, cbargs);
+	in_cursor->buffer = NULL;
+	in_cursor->node = 0;
+}
+
 /*
  * look up all extended attribute keys for a given CNID.
  *
@@ -1172,18 +1442,16 @@ hfslib_find_attribute_records_for_cnid(hfs_volume* in_vol, hfs_cnid_t cnid,
 	hfs_attribute_key_t** out_attr_keys, uint32_t* out_num_attrs,
 	hfs_callback_args* cbargs)
 {
-	hfs_node_descriptor_t nd;
-	hfs_extent_descriptor_t* extents;
+	hfs_node_view_t view;
 	hfs_attribute_record_t record;
+	hfs_attribute_key_t searchkey;
 	hfs_attribute_key_t* curkey;
 	hfs_attribute_key_t* resized_keys;
-	void** recs;
 	void* node;
-	uint64_t bytesread;
-	uint32_t nodes_visited, curnode;
-	uint16_t* recsizes;
-	uint16_t level, numextents, recnum;
-	int result;
+	void* rec;
+	uint32_t nodes_visited, curnode, bufnode;
+	uint16_t level, recsize;
+	int recnum, result, cmp;
 
 	if (out_num_attrs != NULL)
 		*out_num_attrs = 0;
@@ -1194,11 +1462,8 @@ hfslib_find_attribute_records_for_cnid(hfs_volume* in_vol, hfs_cnid_t cnid,
 		return 1;
 
 	result = 1;
-	extents = NULL;
-	recs = NULL;
-	recsizes = NULL;
 	node = NULL;
-	nd.num_recs = 0;
+	bufnode = 0;
 
 	/*
 	 * Not all volumes have an attributes file. this is not an error, but
@@ -1213,96 +1478,81 @@ hfslib_find_attribute_records_for_cnid(hfs_volume* in_vol, hfs_cnid_t cnid,
 	if (curkey == NULL)
 		HFS_LIBERR("could not allocate attributes search key");
 
-	node = hfslib_malloc(in_vol->ahr.node_size, cbargs);
-	if (node == NULL)
-		HFS_LIBERR("could not allocate attributes file node buffer");
-
 	curnode = in_vol->ahr.root_node;
 
-	numextents = hfslib_get_file_extents(in_vol, HFS_CNID_ATTRIBUTES,
-		HFS_DATAFORK, &extents, NULL);
-	if (numextents == 0)
+	if (in_vol->attrextents == NULL)
 		HFS_LIBERR("could not locate attributes file extents");
 
+	/* every attribute key for this cnid sorts after this one */
+	if (hfslib_make_attribute_key(cnid, 0, 0, NULL, &searchkey) == 0)
+		HFS_LIBERR("could not make attributes search key");
+
 	for (level = 0, nodes_visited = 0; curnode != 0 &&
 		level < in_vol->ahr.tree_depth &&
 		nodes_visited < in_vol->ahr.total_nodes;
 		nodes_visited++) {
 
-		if (hfslib_readd_with_extents(in_vol, node, &bytesread,
-			in_vol->ahr.node_size, curnode * in_vol->ahr.node_size, extents,
-			numextents, cbargs) != 0)
+		if (hfslib_get_node(in_vol, HFS_ATTRIBUTES_FILE, curnode,
+			in_vol->attrextents, in_vol->numattrextents, &node, cbargs) != 0)
 			HFS_LIBERR("could not read attribute node #%" PRIu32, curnode);
+		bufnode = curnode;
 
-		if (hfslib_reada_node(node, &nd, &recs, &recsizes, HFS_ATTRIBUTES_FILE,
-			in_vol, cbargs) == 0)
+		if (hfslib_read_node_view(node, HFS_ATTRIBUTES_FILE, in_vol,
+			&view) != 0)
 			HFS_LIBERR("could not parse attribute node #%" PRIu32, curnode);
 
-		if ((level < in_vol->ahr.tree_depth - 1 && nd.kind != HFS_INDEXNODE) ||
-			(level == in_vol->ahr.tree_depth - 1 && nd.kind != HFS_LEAFNODE))
+		if ((level < in_vol->ahr.tree_depth - 1 &&
+			view.nd.kind != HFS_INDEXNODE) ||
+			(level == in_vol->ahr.tree_depth - 1 &&
+			view.nd.kind != HFS_LEAFNODE))
 			HFS_LIBERR("attribute node kind unexpected at depth %" PRIu16 " #%"
 				PRIu32, level, curnode);
 
-		for (recnum = 0, curnode = 0; recnum < nd.num_recs; recnum++) {
-			if (hfslib_read_attribute_record(recs[recnum], recsizes[recnum],
-				nd.kind, NULL, curkey, NULL, in_vol) == 0)
-				HFS_LIBERR("could not read attribute record #%" PRIu16, recnum);
-
+		recnum = hfslib_search_node(in_vol, &view, &searchkey, NULL, curkey,
+			&cmp);
+		if (recnum == -2)
+			HFS_LIBERR("could not read attribute node #%" PRIu32 " records",
+				curnode);
 
-			if (cnid < curkey->cnid) {
-				if (recnum > 0 && nd.kind == HFS_INDEXNODE) {
-					/* might be in the previous node */
-					if (hfslib_read_attribute_record(recs[recnum - 1],
-						recsizes[recnum - 1], nd.kind, &record, NULL, NULL,
-						in_vol) == 0)
-						HFS_LIBERR("could not read attribute record %d",
-							recnum-1);
-
-					curnode = record.child_node;
-					level++;
-				}
+		/*
+		 * the first matching key may be anywhere after the last key
+		 * preceding our search key, which might not exist in this node.
+		 * leaf nodes reached horizontally are entirely past the search key,
+		 * so they are scanned from the start.
+		 */
+		if (recnum == -1)
+			recnum = 0;
+
+		if (view.nd.kind == HFS_INDEXNODE) {
+			rec = hfslib_get_node_record(&view, recnum, &recsize);
+			if (hfslib_read_attribute_record(rec, recsize,
+				view.nd.kind, &record, NULL, NULL, in_vol) == 0)
+				HFS_LIBERR("could not read attribute record #%d", recnum);
+
+			curnode = record.child_node;
+			level++;
+			hfslib_release_node(in_vol, HFS_ATTRIBUTES_FILE, bufnode, node,
+				cbargs);
+			node = NULL;
+			continue;
+		}
 
-				/*
-				 * otherwise the first record in the first index node is greater
-				 * than our search key, or all further keys in the tree are
-				 * greater and we've found nothing. either way we're done,
-				 * there's no matching xattr
-				 */
-				break;
-			}
+		for (curnode = 0; recnum < view.nd.num_recs; recnum++) {
+			rec = hfslib_get_node_record(&view, recnum, &recsize);
+			if (hfslib_read_attribute_record(rec, recsize,
+				view.nd.kind, NULL, curkey, NULL, in_vol) == 0)
+				HFS_LIBERR("could not read attribute record #%d", recnum);
 
-			if ((cnid == curkey->cnid || recnum == nd.num_recs - 1) &&
-				nd.kind == HFS_INDEXNODE) {
-				/*
-				 * either an exact match or we've reached the end of the node
-				 * and need to check the last index. if this is the first index
-				 * node descend into it, otherwise the cnid's attrs may start in
-				 * the previous node
-				 */
-				if (recnum > 0 && cnid == curkey->cnid)
-					recnum--;
-				if (hfslib_read_attribute_record(recs[recnum],
-					recsizes[recnum], nd.kind, &record, NULL, NULL,
-					in_vol) == 0)
-					HFS_LIBERR("could not read attribute record #%" PRIu16,
-						recnum);
-
-				curnode = record.child_node;
-				level++;
+			/* all further keys in the tree are greater, we're done */
+			if (cnid < curkey->cnid)
 				break;
-			}
 
-			if (recnum == nd.num_recs - 1) {
-				/*
-				 * we're at the end of a leaf node. if we're here we may
-				 * have found matching keys in this or the subsequent node
-				 * either way we need to continue the search horizontally.
-				 * continue for one more node, unless our key already matches
-				 * in which case continue for as long as we can
-				 */
-				if (cnid == curkey->cnid || curnode != nd.blink)
-					curnode = nd.flink;
-			}
+			/*
+			 * we're at the end of a leaf node without passing our cnid, so
+			 * matching keys may continue in the next one
+			 */
+			if (recnum == view.nd.num_recs - 1)
+				curnode = view.nd.flink;
 
 			if (cnid == curkey->cnid && curkey->start_block == 0) {
 				/* found an xattr */
@@ -1322,11 +1572,8 @@ hfslib_find_attribute_records_for_cnid(hfs_volume* in_vol, hfs_cnid_t cnid,
 
 				*out_attr_keys = resized_keys;
 
-				if (hfslib_read_attribute_record(recs[recnum], recsizes[recnum],
-					nd.kind, NULL, *out_attr_keys + *out_num_attrs, NULL,
-					in_vol) == 0)
-					HFS_LIBERR("could not read attribute record #%" PRIu16,
-						recnum);
+				memcpy(*out_attr_keys + *out_num_attrs, curkey,
+					sizeof(hfs_attribute_key_t));
 
 				(*out_num_attrs)++;
 			}
@@ -1334,225 +1581,440 @@ hfslib_find_attribute_records_for_cnid(hfs_volume* in_vol, hfs_cnid_t cnid,
 			/* continue on to the next record */
 		}
 
-		hfslib_free_recs(&recs, &recsizes, &nd.num_recs, cbargs);
+		hfslib_release_node(in_vol, HFS_ATTRIBUTES_FILE, bufnode, node, cbargs);
+		node = NULL;
 	}
 
 	result = 0;
 
 error:
-	hfslib_free(extents, cbargs);
-	hfslib_free_recs(&recs, &recsizes, &nd.num_recs, cbargs);
 	hfslib_free(curkey, cbargs);
-	hfslib_free(node, cbargs);
+	hfslib_release_node(in_vol, HFS_ATTRIBUTES_FILE, bufnode, node, cbargs);
 
 	return result;
 }
 
 /*
- * hfslib_get_directory_contents()
- *
- * Finds the immediate children of a given directory CNID and places their 
- * CNIDs in an array allocated here. The first child is found by doing a
- * catalog search that only compares parent CNIDs (ignoring file/folder names)
- * and skips over thread records. Then the remaining children are listed in 
- * ascending order by name, according to the HFS+ spec, so just read off each
- * successive leaf node until a different parent CNID is found.
- * 
- * If out_childnames is not NULL, it will be allocated and set to an array of
- * hfs_unistr255_t's which correspond to the name of the child with that same
- * index.
+ * hfslib_open_directory()
  *
- * out_children may be NULL.
+ * Prepares out_cursor to list the immediate children of the folder in_dir
+ * one at a time with hfslib_read_directory(). The cursor holds on to at most
+ * one catalog node at a time, and must be closed with
+ * hfslib_close_directory() once the caller is done with it, whether or not
+ * the listing was read to the end.
  *
  * Returns 0 on success.
  */
 int
-hfslib_get_directory_contents(
+hfslib_open_directory(
 	hfs_volume* in_vol,
 	hfs_cnid_t in_dir,
-	hfs_catalog_keyed_record_t** out_children,
-	hfs_unistr255_t** out_childnames,
-	uint32_t* out_numchildren,
+	hfs_dir_cursor_t* out_cursor,
 	hfs_callback_args* cbargs)
 {
-	hfs_node_descriptor_t			nd = { .num_recs = 0 };
-	hfs_extent_descriptor_t*		extents;
-	hfs_catalog_keyed_record_t		currec;
-	hfs_catalog_key_t	curkey;
-	void**				recs;
-	void*				buffer;
-	void*				ptr; /* temporary pointer for realloc() */
-	uint64_t			bytesread;
-	uint32_t			curnode;
-	uint32_t			lastnode;
-	uint16_t*			recsizes;
-	uint16_t			numextents;
-	uint16_t			recnum;
-	int16_t				leaftype;
-	int					keycompare;
-	int					result;
+	if (out_cursor == NULL)
+		return 1;
 
-	if (in_vol == NULL || in_dir == 0 || out_numchildren == NULL)
+	out_cursor->parent = in_dir;
+	out_cursor->node = 0;
+	out_cursor->buffer = NULL;
+
+	if (in_vol == NULL || in_dir == 0)
 		return 1;
 
-	result = 1;
-	buffer = NULL;
-	extents = NULL;
-	lastnode = 0;
-	recs = NULL;
-	recsizes = NULL;
-	*out_numchildren = 0;
-	if (out_children != NULL)
-		*out_children = NULL;
-	if (out_childnames != NULL)
-		*out_childnames = NULL;
+	return hfslib_seek_directory(in_vol, out_cursor, NULL, cbargs);
+}
 
-	buffer = hfslib_malloc(in_vol->chr.node_size, cbargs);
-	if (buffer == NULL)
-		HFS_LIBERR("could not allocate node buffer");
+/*
+ * hfslib_seek_directory()
+ *
+ * Positions in_cursor so that the next child read is the first one sorting
+ * after in_key, which is usually the key of a child previously read from a
+ * cursor on the same folder. A NULL in_key rewinds to the first child.
+ *
+ * Since all children share the folder's CNID as their parent, they sort
+ * after its thread record (the folder's CNID with an empty name), so
+ * rewinding is a seek to the thread record's key.
+ *
+ * Returns 0 on success.
+ */
+int
+hfslib_seek_directory(
+	hfs_volume* in_vol,
+	hfs_dir_cursor_t* in_cursor,
+	const hfs_catalog_key_t* in_key,
+	hfs_callback_args* cbargs)
+{
+	hfs_catalog_keyed_record_t	currec;
+	hfs_catalog_key_t	searchkey;
+	hfs_catalog_key_t	curkey;
+	uint32_t			curnode;
+	int16_t				leaftype;
+	int					keycompare;
+	int					recnum;
+
+	if (in_vol == NULL || in_cursor == NULL)
+		return 1;
+
+	hfslib_close_directory(in_vol, in_cursor, cbargs);
 
-	numextents = hfslib_get_file_extents(in_vol, HFS_CNID_CATALOG,
-		HFS_DATAFORK, &extents, cbargs);
-	if (numextents == 0)
+	if (in_vol->catextents == NULL)
 		HFS_LIBERR("could not locate fork extents");
 
-	nd.num_recs = 0;
-	curnode = in_vol->chr.root_node;
+	if (in_key != NULL)
+		memcpy(&searchkey, in_key, sizeof(searchkey));
+	else if (hfslib_make_catalog_key(in_cursor->parent, 0, NULL,
+		&searchkey) == 0)
+		HFS_LIBERR("could not make catalog search key");
 
-	while (1)
-	{
-		hfslib_free_recs(&recs, &recsizes, &nd.num_recs, cbargs);
-		recnum = 0;
+	curnode = in_vol->chr.root_node;
 
-		if (hfslib_readd_with_extents(in_vol, buffer, &bytesread, 
-			in_vol->chr.node_size, curnode * in_vol->chr.node_size, extents, 
-			numextents, cbargs) != 0)
+	while (1) {
+		if (hfslib_get_node(in_vol, HFS_CATALOG_FILE, curnode,
+			in_vol->catextents, in_vol->numcatextents, &in_cursor->buffer,
+			cbargs) != 0)
 			HFS_LIBERR("could not read catalog node #%i", curnode);
+		in_cursor->node = curnode;
 
-		if (hfslib_reada_node(buffer, &nd, &recs, &recsizes, HFS_CATALOG_FILE,
-			in_vol, cbargs) == 0)
+		if (hfslib_read_node_view(in_cursor->buffer, HFS_CATALOG_FILE, in_vol,
+			&in_cursor->view) != 0)
 			HFS_LIBERR("could not parse catalog node #%i", curnode);
 
-		for (recnum = 0; recnum < nd.num_recs; recnum++)
-		{
-			leaftype = nd.kind; /* needed b/c leaftype might be modified now */
-			if (hfslib_read_catalog_keyed_record(recs[recnum], &currec,
-				&leaftype, &curkey, in_vol) == 0)
-				HFS_LIBERR("could not read cat record %i:%i", curnode, recnum);
+		recnum = hfslib_search_node(in_vol, &in_cursor->view, &searchkey,
+			NULL, &curkey, &keycompare);
+		if (recnum == -2)
+			HFS_LIBERR("could not read catalog node #%i records", curnode);
 
-			if (nd.kind == HFS_INDEXNODE)
-			{
-				keycompare = in_dir - curkey.parent_cnid;
-				if (keycompare < 0) {
-					/* Check if key is less than *every* record, which should 
-					 * never happen if the volume and key are good. */
-					if (recnum == 0)
-						HFS_LIBERR("all records greater than key");
-
-					/* Otherwise, we've found the first record that exceeds our 
-					 * key, so retrieve the previous, lesser record. */
-					curnode = lastnode;
-					break;
-				} else if (keycompare == 0) {
-					/*
-					 * Normally, if we were doing a typical catalog lookup with
-					 * both a parent cnid AND a name, keycompare==0 would be an
-					 * exact match. However, since we are ignoring object names
-					 * in this case and only comparing parent cnids, a direct
-					 * match on only a parent cnid could mean that we've found
-					 * an object with that parent cnid BUT which is NOT the
-					 * first object (according to the HFS+ spec) with that
-					 * parent cnid. Thus, when we find a parent cnid match, we 
-					 * still go back to the previously found leaf node and start
-					 * checking it for a possible prior instance of an object
-					 * with our desired parent cnid.
-					 */
-					curnode = lastnode;
-					break;					 
-				} else if (recnum == nd.num_recs-1 && keycompare > 0) {
-					/* Descend to child node if we found an exact match, or if
-					 * this is the last pointer record. */
-					curnode = currec.child;
-					break;
-				}
+		if (in_cursor->view.nd.kind == HFS_LEAFNODE)
+			break;
+		else if (in_cursor->view.nd.kind != HFS_INDEXNODE)
+			HFS_LIBERR("unexpected kind for catalog node #%i", curnode);
 
-				lastnode = currec.child;
-			} else {
-				/*
-				 * We have now descended down the hierarchy of index nodes into
-				 * the leaf node that contains the first catalog record with a
-				 * matching parent CNID. Since all leaf nodes are chained
-				 * through their flink/blink, we can simply walk forward through
-				 * this chain, copying every matching non-thread record, until 
-				 * we hit a record with a different parent CNID. At that point,
-				 * we've retrieved all of our directory's items, if any.
-				 */
-				curnode = nd.flink;
-
-				if (curkey.parent_cnid < in_dir) {
-					continue;
-				} else if (curkey.parent_cnid == in_dir) {
-					/* Hide files/folders which are supposed to be invisible
-					 * to users, according to the hfs+ spec. */
-					if (hfslib_is_private_file(&curkey))
-						continue;
-
-					/* leaftype has now been set to the catalog record type */
-					if (leaftype == HFS_REC_FLDR || leaftype == HFS_REC_FILE)
-					{
-						(*out_numchildren)++;
-
-						if (out_children != NULL) {
-							ptr = hfslib_realloc(*out_children, 
-								*out_numchildren *
-								sizeof(hfs_catalog_keyed_record_t), cbargs);
-							if (ptr == NULL)
-								HFS_LIBERR("could not allocate child record");
-							*out_children = ptr;
-
-							memcpy(&((*out_children)[*out_numchildren-1]), 
-								&currec, sizeof(hfs_catalog_keyed_record_t));
-						}
-
-						if (out_childnames != NULL) {
-							ptr = hfslib_realloc(*out_childnames,
-								*out_numchildren * sizeof(hfs_unistr255_t),
-								cbargs);
-							if (ptr == NULL)
-								HFS_LIBERR("could not allocate child name");
-							*out_childnames = ptr;
-
-							memcpy(&((*out_childnames)[*out_numchildren-1]), 
-								&curkey.name, sizeof(hfs_unistr255_t));
-						}
-					}
-				} else {
-					result = 0;
-					/* We have just now passed the last item in the desired
-					 * folder (or the folder was empty), so exit. */
-					goto exit;
-				}
+		/*
+		 * The next child may follow any record preceding the search key,
+		 * even if that is not in this node.
+		 */
+		if (recnum == -1)
+			recnum = 0;
+
+		leaftype = in_cursor->view.nd.kind;
+		if (hfslib_read_catalog_keyed_record(
+			hfslib_get_node_record(&in_cursor->view, recnum, NULL), &currec,
+			&leaftype, &curkey, in_vol) == 0)
+			HFS_LIBERR("could not read cat record %i:%i", curnode, recnum);
+
+		hfslib_release_node(in_vol, HFS_CATALOG_FILE, in_cursor->node,
+			in_cursor->buffer, cbargs);
+		in_cursor->buffer = NULL;
+		curnode = currec.child;
+	}
+
+	/*
+	 * The record found, if any, does not sort after the search key, so the
+	 * listing picks up right after it. This may be past the end of the node,
+	 * in which case hfslib_read_directory() moves on through the flink.
+	 */
+	in_cursor->recnum = recnum + 1;
+	return 0;
+
+error:
+	hfslib_close_directory(in_vol, in_cursor, cbargs);
+	return 1;
+}
+
+/*
+ * hfslib_read_directory()
+ *
+ * Reads the next child of the folder being listed by in_cursor into out_rec,
+ * and its key into out_key if that is not NULL. Children are listed in
+ * catalog order, skipping thread records and files that the HFS+ spec says
+ * should be hidden from users.
+ *
+ * Returns 0 on success, 1 on error, and -1 once there are no more children.
+ */
+int
+hfslib_read_directory(
+	hfs_volume* in_vol,
+	hfs_dir_cursor_t* in_cursor,
+	hfs_catalog_keyed_record_t* out_rec,
+	hfs_catalog_key_t* out_key,
+	hfs_callback_args* cbargs)
+{
+	hfs_catalog_key_t	curkey;
+	uint32_t			curnode;
+	int16_t				leaftype;
+
+	if (in_vol == NULL || in_cursor == NULL || out_rec == NULL)
+		return 1;
+
+	while (in_cursor->buffer != NULL) {
+		/* the directory's items may continue into the next leaf node */
+		if (in_cursor->recnum >= in_cursor->view.nd.num_recs) {
+			curnode = in_cursor->view.nd.flink;
+			hfslib_close_directory(in_vol, in_cursor, cbargs);
+			if (curnode == 0)
+				break;
+
+			if (hfslib_get_node(in_vol, HFS_CATALOG_FILE, curnode,
+				in_vol->catextents, in_vol->numcatextents, &in_cursor->buffer,
+				cbargs) != 0)
+				HFS_LIBERR("could not read catalog node #%i", curnode);
+			in_cursor->node = curnode;
+			in_cursor->recnum = 0;
+
+			if (hfslib_read_node_view(in_cursor->buffer, HFS_CATALOG_FILE,
+				in_vol, &in_cursor->view) != 0)
+				HFS_LIBERR("could not parse catalog node #%i", curnode);
+			if (in_cursor->view.nd.kind != HFS_LEAFNODE)
+				HFS_LIBERR("unexpected kind for catalog node #%i", curnode);
+			continue;
+		}
+
+		leaftype = in_cursor->view.nd.kind;
+		if (hfslib_read_catalog_keyed_record(
+			hfslib_get_node_record(&in_cursor->view, in_cursor->recnum, NULL),
+			out_rec, &leaftype, &curkey, in_vol) == 0)
+			HFS_LIBERR("could not read cat record %i:%i", in_cursor->node,
+				in_cursor->recnum);
+		in_cursor->recnum++;
+
+		if (curkey.parent_cnid < in_cursor->parent)
+			continue;
+		/*
+		 * We have just now passed the last item in the desired folder (or
+		 * the folder was empty), so there is nothing left to read.
+		 */
+		if (curkey.parent_cnid > in_cursor->parent)
+			break;
+
+		/* Hide files/folders which are supposed to be invisible
+		 * to users, according to the hfs+ spec. */
+		if (hfslib_is_private_file(&curkey))
+			continue;
+
+		/* leaftype has now been set to the catalog record type */
+		if (leaftype == HFS_REC_FLDR || leaftype == HFS_REC_FILE) {
+			if (out_key != NULL)
+				memcpy(out_key, &curkey, sizeof(curkey));
+			return 0;
+		}
+	}
+
+	hfslib_close_directory(in_vol, in_cursor, cbargs);
+	return -1;
+
+error:
+	hfslib_close_directory(in_vol, in_cursor, cbargs);
+	return 1;
+}
+
+/*
+ * hfslib_tell_directory()
+ *
+ * Returns the position of in_cursor, from which hfslib_seek_directory_position()
+ * resumes reading with the child that would have been read next. Positions
+ * name a record in a catalog leaf node, so they stay valid for as long as the
+ * catalog isn't modified, which is always the case for a read-only volume.
+ *
+ * Positions are never less than 1<<16, since node 0 is the header node.
+ * Returns 0 if in_cursor is closed or hasn't read any children yet.
+ */
+uint64_t
+hfslib_tell_directory(const hfs_dir_cursor_t* in_cursor)
+{
+	if (in_cursor == NULL || in_cursor->buffer == NULL ||
+		in_cursor->recnum == 0)
+		return 0;
+
+	return (uint64_t)in_cursor->node << 16 | in_cursor->recnum;
+}
+
+/*
+ * hfslib_seek_directory_position()
+ *
+ * Positions in_cursor at in_pos, as returned by hfslib_tell_directory() for a
+ * cursor on the same folder. This only reads the leaf node named by in_pos,
+ * rather than descending the catalog from its root as
+ * hfslib_seek_directory() does.
+ *
+ * Returns 0 on success, and 1 on error or if in_pos does not follow a child
+ * of the cursor's folder.
+ */
+int
+hfslib_seek_directory_position(
+	hfs_volume* in_vol,
+	hfs_dir_cursor_t* in_cursor,
+	uint64_t in_pos,
+	hfs_callback_args* cbargs)
+{
+	hfs_catalog_keyed_record_t	currec;
+	hfs_catalog_key_t	curkey;
+	uint32_t			curnode;
+	uint16_t			recnum;
+	int16_t				leaftype;
+
+	if (in_vol == NULL || in_cursor == NULL)
+		return 1;
+
+	hfslib_close_directory(in_vol, in_cursor, cbargs);
+
+	curnode = (uint32_t)(in_pos >> 16);
+	recnum = (uint16_t)(in_pos & 0xFFFF);
+	if (curnode == 0 || curnode >= in_vol->chr.total_nodes || recnum == 0 ||
+		in_pos >> 48 != 0)
+		HFS_LIBERR("invalid directory position %" PRIu64, in_pos);
+
+	if (in_vol->catextents == NULL)
+		HFS_LIBERR("could not locate fork extents");
+
+	if (hfslib_get_node(in_vol, HFS_CATALOG_FILE, curnode,
+		in_vol->catextents, in_vol->numcatextents, &in_cursor->buffer,
+		cbargs) != 0)
+		HFS_LIBERR("could not read catalog node #%i", curnode);
+	in_cursor->node = curnode;
+	in_cursor->recnum = recnum;
+
+	if (hfslib_read_node_view(in_cursor->buffer, HFS_CATALOG_FILE, in_vol,
+		&in_cursor->view) != 0)
+		HFS_LIBERR("could not parse catalog node #%i", curnode);
+	if (in_cursor->view.nd.kind != HFS_LEAFNODE ||
+		recnum > in_cursor->view.nd.num_recs)
+		HFS_LIBERR("invalid directory position %" PRIu64, in_pos);
+
+	/*
+	 * A position is only ever taken right after reading a child, so the
+	 * record preceding it must belong to the folder being listed.
+	 */
+	leaftype = in_cursor->view.nd.kind;
+	if (hfslib_read_catalog_keyed_record(
+		hfslib_get_node_record(&in_cursor->view, recnum - 1, NULL), &currec,
+		&leaftype, &curkey, in_vol) == 0)
+		HFS_LIBERR("could not read cat record %i:%i", curnode, recnum - 1);
+	if (curkey.parent_cnid != in_cursor->parent)
+		HFS_LIBERR("directory position %" PRIu64 " is not in folder %u",
+			in_pos, in_cursor->parent);
+
+	return 0;
+
+error:
+	hfslib_close_directory(in_vol, in_cursor, cbargs);
+	return 1;
+}
+
+/*
+ * hfslib_close_directory()
+ *
+ * Releases the catalog node held by in_cursor, if any. A closed cursor
+ * reads no further children, but may be repositioned with
+ * hfslib_seek_directory().
+ */
+void
+hfslib_close_directory(
+	hfs_volume* in_vol,
+	hfs_dir_cursor_t* in_cursor,
+	hfs_callback_args* cbargs)
+{
+	if (in_cursor == NULL)
+		return;
+
+	hfslib_release_node(in_vol, HFS_CATALOG_FILE, in_cursor->node,
+		in_cursor->buffer, cbargs);
+	in_cursor->buffer = NULL;
+	in_cursor->node = 0;
+}
+
+/*
+ * hfslib_get_directory_contents()
+ *
+ * Finds the immediate children of a given directory CNID and places their 
+ * CNIDs in an array allocated here, by reading through a cursor opened with
+ * hfslib_open_directory(). The children are listed in ascending order by
+ * name, according to the HFS+ spec.
+ * 
+ * If out_childnames is not NULL, it will be allocated and set to an array of
+ * hfs_unistr255_t's which correspond to the name of the child with that same
+ * index.
+ *
+ * out_children may be NULL.
+ *
+ * Returns 0 on success.
+ */
+int
+hfslib_get_directory_contents(
+	hfs_volume* in_vol,
+	hfs_cnid_t in_dir,
+	hfs_catalog_keyed_record_t** out_children,
+	hfs_unistr255_t** out_childnames,
+	uint32_t* out_numchildren,
+	hfs_callback_args* cbargs)
+{
+	hfs_dir_cursor_t		cursor;
+	hfs_catalog_keyed_record_t		currec;
+	hfs_catalog_key_t	curkey;
+	void*				ptr; /* temporary pointer for realloc() */
+	uint32_t			capacity;
+	int					result;
+
+	if (in_vol == NULL || in_dir == 0 || out_numchildren == NULL)
+		return 1;
+
+	*out_numchildren = 0;
+	capacity = 0;
+	if (out_children != NULL)
+		*out_children = NULL;
+	if (out_childnames != NULL)
+		*out_childnames = NULL;
+
+	if (hfslib_open_directory(in_vol, in_dir, &cursor, cbargs) != 0)
+		return 1;
+
+	while ((result = hfslib_read_directory(in_vol, &cursor, &currec, &curkey,
+		cbargs)) == 0) {
+		/* grow geometrically so that large folders aren't copied per child */
+		if (*out_numchildren == capacity) {
+			capacity = capacity ? capacity * 2 : 16;
+
+			if (out_children != NULL) {
+				ptr = hfslib_realloc(*out_children,
+					capacity * sizeof(hfs_catalog_keyed_record_t), cbargs);
+				if (ptr == NULL)
+					HFS_LIBERR("could not allocate child record");
+				*out_children = ptr;
+			}
+
+			if (out_childnames != NULL) {
+				ptr = hfslib_realloc(*out_childnames,
+					capacity * sizeof(hfs_unistr255_t), cbargs);
+				if (ptr == NULL)
+					HFS_LIBERR("could not allocate child name");
+				*out_childnames = ptr;
 			}
 		}
+
+		if (out_children != NULL)
+			memcpy(&((*out_children)[*out_numchildren]), &currec,
+				sizeof(hfs_catalog_keyed_record_t));
+		if (out_childnames != NULL)
+			memcpy(&((*out_childnames)[*out_numchildren]), &curkey.name,
+				sizeof(hfs_unistr255_t));
+		(*out_numchildren)++;
 	}
 
-	result = 0;
-	goto exit;
+	if (result == -1)
+		return 0;
 
 error:
+	hfslib_close_directory(in_vol, &cursor, cbargs);
 	if (out_children != NULL && *out_children != NULL)
 		hfslib_free(*out_children, cbargs);
 	if (out_childnames != NULL && *out_childnames != NULL)
 		hfslib_free(*out_childnames, cbargs);
-	/* FALLTHROUGH */
-
-exit:
-	if (extents != NULL)
-		hfslib_free(extents, cbargs);
-	hfslib_free_recs(&recs, &recsizes, &nd.num_recs, cbargs);
-	if (buffer != NULL)
-		hfslib_free(buffer, cbargs);
-	return result;
+	if (out_children != NULL)
+		*out_children = NULL;
+	if (out_childnames != NULL)
+		*out_childnames = NULL;
+	*out_numchildren = 0;
+	return 1;
 }
 
 int
@@ -2502,6 +2964,204 @@ hfslib_read_attribute_record(
 	return (uint8_t*)ptr - (uint8_t*)in_bytes;
 }
 
+/*
+ * hfslib_read_node_view()
+ *
+ * Parses the node descriptor of an index or leaf node and validates its record
+ * offset table, without copying anything out of the node. Records are then
+ * accessed in place with hfslib_get_node_record(), which is valid for as long
+ * as in_bytes is.
+ *
+ * inout_volume must have the node size of in_parent_file set, so this can't be
+ * used on the header node before the volume has been opened.
+ *
+ * Returns 0 on success.
+ */
+int
+hfslib_read_node_view(
+	void* in_bytes,
+	hfs_btree_file_type in_parent_file,
+	hfs_volume* in_volume,
+	hfs_node_view_t* out_view)
+{
+	void*		ptr;
+	uint8_t*	offsets;
+	uint16_t	nodesize;
+	uint16_t	offset, lastoffset;
+	int			i;
+
+	if (in_bytes == NULL || in_volume == NULL || out_view == NULL)
+		return 1;
+
+	switch (in_parent_file) {
+		case HFS_CATALOG_FILE:
+			nodesize = in_volume->chr.node_size;
+			break;
+
+		case HFS_EXTENTS_FILE:
+			nodesize = in_volume->ehr.node_size;
+			break;
+
+		case HFS_ATTRIBUTES_FILE:
+			nodesize = in_volume->ahr.node_size;
+			break;
+
+		default:
+			return 1;
+	}
+
+	ptr = in_bytes;
+	out_view->nd.flink = be32tohp(&ptr);
+	out_view->nd.blink = be32tohp(&ptr);
+	out_view->nd.kind = *(((int8_t*)ptr));
+	ptr = (uint8_t*)ptr + 1;
+	out_view->nd.height = *(((uint8_t*)ptr));
+	ptr = (uint8_t*)ptr + 1;
+	out_view->nd.num_recs = be16tohp(&ptr);
+	out_view->nd.reserved = be16tohp(&ptr);
+	out_view->node = in_bytes;
+	out_view->node_size = nodesize;
+	out_view->file = in_parent_file;
+
+	if (out_view->nd.num_recs == 0 ||
+		nodesize < 14 + (out_view->nd.num_recs + 1) * sizeof(uint16_t))
+		return 1;
+
+	/*
+	 * The offsets are stored backwards from the end of the node, followed by
+	 * the offset to the node's free space. They must start right after the
+	 * node descriptor and increase up to the start of the offset table.
+	 */
+	offsets = (uint8_t*)in_bytes + nodesize;
+	lastoffset = 0;
+	for (i = 0; i <= out_view->nd.num_recs; i++) {
+		offsets -= sizeof(uint16_t);
+		offset = be16toh(*(uint16_t*)offsets);
+		if (i == 0 ? offset != 14 : offset <= lastoffset)
+			return 1;
+		lastoffset = offset;
+	}
+	if (lastoffset > offsets - (uint8_t*)in_bytes)
+		return 1;
+
+	return 0;
+}
+
+/*
+ * hfslib_get_node_record()
+ *
+ * Returns a pointer to record in_recnum of a node parsed with
+ * hfslib_read_node_view(), and sets out_size (which may be NULL) to its size.
+ * As with hfslib_reada_node(), a keyed record's trailing pad byte is not
+ * counted in its size.
+ */
+void*
+hfslib_get_node_record(
+	const hfs_node_view_t* in_view,
+	uint16_t in_recnum,
+	uint16_t* out_size)
+{
+	uint8_t*	offsets;
+	uint16_t	start, end;
+
+	KASSERT(in_recnum < in_view->nd.num_recs);
+
+	offsets = (uint8_t*)in_view->node + in_view->node_size -
+		(in_recnum + 1) * sizeof(uint16_t);
+	start = be16toh(*(uint16_t*)offsets);
+
+	if (out_size != NULL) {
+		end = be16toh(*(uint16_t*)(offsets - sizeof(uint16_t)));
+		*out_size = end - start;
+		if ((in_view->nd.kind == HFS_LEAFNODE ||
+			in_view->nd.kind == HFS_INDEXNODE) && *out_size % 2 == 1)
+			(*out_size)--;
+	}
+
+	return (uint8_t*)in_view->node + start;
+}
+
+/*
+ * hfslib_search_node()
+ *
+ * Binary searches the records of an index or leaf node for the last record
+ * whose key does not exceed in_key. Only the record keys are decoded, into
+ * out_scratch_key, which like in_key must be a hfs_catalog_key_t,
+ * hfs_extent_key_t or hfs_attribute_key_t according to the node's file.
+ * For catalog nodes, in_keycmp replaces in_vol->keycmp unless it is NULL.
+ *
+ * Returns the index of the record found and sets out_cmp to the result of
+ * comparing in_key against its key, so that 0 means an exact match. Returns
+ * -1 if every record in the node is greater than in_key, or -2 if a record
+ * key could not be read.
+ */
+int
+hfslib_search_node(
+	hfs_volume* in_vol,
+	const hfs_node_view_t* in_view,
+	const void* in_key,
+	int (*in_keycmp)(const void*, const void*),
+	void* out_scratch_key,
+	int* out_cmp)
+{
+	void*	rec;
+	int16_t	rectype;
+	uint16_t	recsize;
+	int		lo, hi, mid, found, cmp;
+
+	if (in_keycmp == NULL)
+		in_keycmp = in_vol->keycmp;
+
+	found = -1;
+	*out_cmp = -1;
+	lo = 0;
+	hi = in_view->nd.num_recs - 1;
+
+	while (lo <= hi) {
+		mid = lo + (hi - lo) / 2;
+		rec = hfslib_get_node_record(in_view, mid, &recsize);
+
+		switch (in_view->file) {
+		case HFS_CATALOG_FILE:
+			rectype = in_view->nd.kind;
+			if (hfslib_read_catalog_keyed_record(rec, NULL, &rectype,
+				out_scratch_key, in_vol) == 0)
+				return -2;
+			cmp = in_keycmp(in_key, out_scratch_key);
+			break;
+
+		case HFS_EXTENTS_FILE:
+			if (hfslib_read_extent_record(rec, NULL, in_view->nd.kind,
+				out_scratch_key, in_vol) == 0)
+				return -2;
+			cmp = hfslib_compare_extent_keys(in_key, out_scratch_key);
+			break;
+
+		case HFS_ATTRIBUTES_FILE:
+			if (hfslib_read_attribute_record(rec, recsize, in_view->nd.kind,
+				NULL, out_scratch_key, NULL, in_vol) == 0)
+				return -2;
+			cmp = hfslib_compare_attribute_keys(in_key, out_scratch_key);
+			break;
+
+		default:
+			return -2;
+		}
+
+		if (cmp < 0)
+			hi = mid - 1;
+		else {
+			found = mid;
+			*out_cmp = cmp;
+			if (cmp == 0)
+				break;
+			lo = mid + 1;
+		}
+	}
+
+	return found;
+}
+
 void
 hfslib_free_recs(
 	void*** inout_node_recs,
@@ -2777,8 +3437,33 @@ hfslib_readd_with_extents(
 	uint16_t	in_numextents,
 	hfs_callback_args*	cbargs)
 {
+	return hfslib_readd_with_extent_offsets(in_vol, out_bytes, out_bytesread,
+		in_length, in_offset, in_extents, NULL, in_numextents, cbargs);
+}
+
+/*
+ *	hfslib_readd_with_extent_offsets()
+ *
+ *	The same as hfslib_readd_with_extents(), but if in_offsets is a table
+ *	from hfslib_get_extent_offsets() for in_extents, the first extent to read
+ *	from is found by binary search rather than by summing the lengths of all
+ *	those before it. in_offsets may be NULL.
+ */
+int
+hfslib_readd_with_extent_offsets(
+	hfs_volume*	in_vol,
+	void*		out_bytes,
+	uint64_t*	out_bytesread,
+	uint64_t	in_length,
+	uint64_t	in_offset,
+	hfs_extent_descriptor_t in_extents[],
+	const uint64_t	in_offsets[],
+	uint16_t	in_numextents,
+	hfs_callback_args*	cbargs)
+{
+	hfs_io_segment_t	segs[HFS_READ_SEGMENTS];
 	uint64_t	ext_length, last_offset;
-	uint16_t	i;
+	uint16_t	i, lo, hi, mid, n, nsegs;
 	int			error;
 
 	if (in_vol == NULL || out_bytes == NULL || in_extents == NULL ||
@@ -2787,12 +3472,37 @@ hfslib_readd_with_extents(
 
 	*out_bytesread = 0;
 	last_offset = 0;
+	i = 0;
+
+	/* find the last extent starting at or before in_offset */
+	if (in_offsets != NULL) {
+		lo = 0;
+		hi = in_numextents;
+		while (hi - lo > 1) {
+			mid = lo + (hi - lo) / 2;
+			if (in_offsets[mid] <= in_offset)
+				lo = mid;
+			else
+				hi = mid;
+		}
+		i = lo;
+		last_offset = in_offsets[lo];
+	}
 
-	for (i = 0; i < in_numextents; i++)
+	/*
+	 * the pieces of the range are gathered into segments, merging those of
+	 * extents that follow each other on disk, and read in batches
+	 */
+	nsegs = 0;
+	for (; i < in_numextents; i++)
 	{
 		if (in_extents[i].block_count == 0)
 			continue;
 
+		/* the rest of the extents all lie past the end of the range */
+		if (last_offset > in_offset + in_length)
+			break;
+
 		ext_length = (uint64_t)in_extents[i].block_count * in_vol->vh.block_size;
 
 		if (UINT64_MAX - last_offset < ext_length)
@@ -2801,32 +3511,198 @@ hfslib_readd_with_extents(
 				ext_length);
 
 		if (in_offset < last_offset+ext_length
-			&& in_offset+in_length >= last_offset)
+			&& in_offset+in_length > last_offset)
 		{
-			uint64_t	isect_start, isect_end;
+			uint64_t	isect_start, isect_end, disk_offset;
 
 			isect_start = max(in_offset, last_offset);
 			isect_end = min(in_offset+in_length, last_offset+ext_length);
-			error = hfslib_readd(in_vol, out_bytes, isect_end-isect_start,
-				isect_start - last_offset + (uint64_t)in_extents[i].start_block
-					* in_vol->vh.block_size, cbargs);
-
-			if (error != 0)
-				return error;
+			disk_offset = isect_start - last_offset +
+				(uint64_t)in_extents[i].start_block * in_vol->vh.block_size;
+
+			if (nsegs > 0 && segs[nsegs-1].offset + segs[nsegs-1].length ==
+				disk_offset)
+				segs[nsegs-1].length += isect_end-isect_start;
+			else {
+				if (nsegs == HFS_READ_SEGMENTS) {
+					if ((error = hfslib_readdv(in_vol, segs, nsegs,
+						cbargs)) != 0)
+						return error;
+					for (n = 0; n < nsegs; n++)
+						*out_bytesread += segs[n].length;
+					nsegs = 0;
+				}
+				segs[nsegs].buffer = out_bytes;
+				segs[nsegs].length = isect_end-isect_start;
+				segs[nsegs].offset = disk_offset;
+				nsegs++;
+			}
 
-			*out_bytesread += isect_end-isect_start;
 			out_bytes = (uint8_t*)out_bytes + isect_end-isect_start;
 		}
 
 		last_offset += ext_length;
 	}
 
+	if (nsegs > 0) {
+		if ((error = hfslib_readdv(in_vol, segs, nsegs, cbargs)) != 0)
+			return error;
+		for (n = 0; n < nsegs; n++)
+			*out_bytesread += segs[n].length;
+	}
+
 	return 0;
 
 error:
 	return -1;
 }
 
+/*
+ *	hfslib_get_extent_offsets()
+ *
+ *	Sets out_offsets to a newly allocated table of in_numextents+1 byte
+ *	offsets for hfslib_readd_with_extent_offsets(), where entry i is the offset
+ *	into the fork at which in_extents[i] begins and the last is the fork's
+ *	allocated size. Forks with no more than the eight extents of a catalog
+ *	record are scanned quickly enough without one, so for those out_offsets is
+ *	set to NULL. Returns 0 on success.
+ */
+int
+hfslib_get_extent_offsets(
+	hfs_volume*	in_vol,
+	const hfs_extent_descriptor_t in_extents[],
+	uint16_t	in_numextents,
+	uint64_t**	out_offsets,
+	hfs_callback_args*	cbargs)
+{
+	uint64_t*	offsets;
+	uint64_t	ext_length;
+	uint16_t	i;
+
+	if (out_offsets == NULL)
+		return 1;
+	*out_offsets = NULL;
+
+	if (in_vol == NULL || in_extents == NULL)
+		return 1;
+
+	if (in_numextents <= 8)
+		return 0;
+
+	offsets = hfslib_malloc(((size_t)in_numextents + 1) * sizeof(uint64_t),
+		cbargs);
+	if (offsets == NULL)
+		return 1;
+
+	offsets[0] = 0;
+	for (i = 0; i < in_numextents; i++) {
+		ext_length = (uint64_t)in_extents[i].block_count *
+			in_vol->vh.block_size;
+		if (UINT64_MAX - offsets[i] < ext_length) {
+			hfslib_free(offsets, cbargs);
+			HFS_LIBERR("extent length exceeds 16 exabytes at #%" PRIu16
+				", offset %" PRIu64 " length %" PRIu64, i, offsets[i],
+				ext_length);
+		}
+		offsets[i + 1] = offsets[i] + ext_length;
+	}
+
+	*out_offsets = offsets;
+	return 0;
+
+error:
+	return 1;
+}
+
+/*
+ *	hfslib_get_node()
+ *
+ *	Sets out_node to a buffer holding the raw contents of node number in_node
+ *	of the given b-tree file, whose extents are in_extents. The node is taken
+ *	from the application's node cache if it provides one, otherwise it is read
+ *	from disk into a newly allocated buffer. Either way the buffer must be
+ *	returned with hfslib_release_node() once the caller is done with it, and
+ *	must not be modified. Returns 0 on success.
+ */
+int
+hfslib_get_node(
+	hfs_volume*	in_vol,
+	hfs_btree_file_type	in_file,
+	uint32_t	in_node,
+	hfs_extent_descriptor_t in_extents[],
+	uint16_t	in_numextents,
+	void**		out_node,
+	hfs_callback_args*	cbargs)
+{
+	void*		buffer;
+	uint64_t	bytesread;
+	uint32_t	nodesize;
+
+	if (in_vol == NULL || out_node == NULL)
+		return 1;
+
+	*out_node = NULL;
+
+	switch (in_file) {
+		case HFS_CATALOG_FILE:
+			nodesize = in_vol->chr.node_size;
+			break;
+		case HFS_EXTENTS_FILE:
+			nodesize = in_vol->ehr.node_size;
+			break;
+		case HFS_ATTRIBUTES_FILE:
+			nodesize = in_vol->ahr.node_size;
+			break;
+		default:
+			return 1;
+	}
+
+	if (hfs_gcb.getnode != NULL) {
+		*out_node = hfs_gcb.getnode(in_vol, in_file, in_node, cbargs);
+		if (*out_node != NULL)
+			return 0;
+	}
+
+	buffer = hfslib_malloc(nodesize, cbargs);
+	if (buffer == NULL)
+		return 1;
+
+	if (hfslib_readd_with_extents(in_vol, buffer, &bytesread, nodesize,
+		(uint64_t)in_node * nodesize, in_extents, in_numextents, cbargs) != 0
+		|| bytesread != nodesize) {
+		hfslib_free(buffer, cbargs);
+		return 1;
+	}
+
+	if (hfs_gcb.putnode != NULL)
+		buffer = hfs_gcb.putnode(in_vol, in_file, in_node, buffer, cbargs);
+
+	*out_node = buffer;
+	return 0;
+}
+
+/*
+ *	hfslib_release_node()
+ *
+ *	Releases a node buffer obtained from hfslib_get_node().
+ */
+void
+hfslib_release_node(
+	hfs_volume*	in_vol,
+	hfs_btree_file_type	in_file,
+	uint32_t	in_node,
+	void*		in_buffer,
+	hfs_callback_args*	cbargs)
+{
+	if (in_buffer == NULL)
+		return;
+
+	if (hfs_gcb.releasenode != NULL)
+		hfs_gcb.releasenode(in_vol, in_file, in_node, in_buffer, cbargs);
+	else
+		hfslib_free(in_buffer, cbargs);
+}
+
 #if 0
 #pragma mark -
 #pragma mark Callback Wrappers
@@ -2908,6 +3784,32 @@ hfslib_readd(
 	return -1;
 }
 
+int
+hfslib_readdv(
+	hfs_volume* in_vol,
+	const hfs_io_segment_t* in_segments,
+	uint32_t in_count,
+	hfs_callback_args* cbargs)
+{
+	uint32_t	i;
+	int			error;
+
+	if (in_vol == NULL || (in_segments == NULL && in_count > 0))
+		return -1;
+
+	if (hfs_gcb.readv != NULL)
+		return hfs_gcb.readv(in_vol, in_segments, in_count, cbargs);
+
+	for (i = 0; i < in_count; i++) {
+		error = hfslib_readd(in_vol, in_segments[i].buffer,
+			in_segments[i].length, in_segments[i].offset, cbargs);
+		if (error != 0)
+			return error;
+	}
+
+	return 0;
+}
+
 #if 0
 #pragma mark -
 #pragma mark Other
@@ -2985,6 +3887,139 @@ hfslib_make_attribute_key(
 	return out_key->key_len;
 }
 
+/*
+ * Case folding leaves the ASCII range alone except for lowercasing A-Z, and
+ * none of it is ignorable, so runs of ASCII characters can be compared
+ * without consulting hfs_gcft. NUL is excluded since it folds to 0xFFFF.
+ */
+#define HFS_IS_ASCII(c)		((unichar_t)((c) - 1) < 0x7F)
+#define HFS_FOLD_ASCII(c)	\
+	((unichar_t)((c) + (((unichar_t)((c) - 'A') < 26) << 5)))
+
+static inline unichar_t
+hfs_fold_char(unichar_t c)
+{
+	unichar_t lc;
+
+	lc = hfs_gcft[c >> 8];
+	if (lc == 0)
+		return c;
+	return hfs_gcft[lc + (c & 0x00FF)];
+}
+
+/*
+ * Returns how many of the 8 code units at a and b are, from the start, ASCII
+ * on both sides and equal after case folding.
+ */
+static inline int
+hfs_fold_ascii_prefix8(const unichar_t* a, const unichar_t* b)
+{
+#if defined(HFS_SIMD_SSE2)
+	__m128i	va, vb, zero, hi, ascii, upper, fa, fb;
+	int		mask;
+
+	va = _mm_loadu_si128((const __m128i*)a);
+	vb = _mm_loadu_si128((const __m128i*)b);
+	zero = _mm_setzero_si128();
+	hi = _mm_set1_epi16((short)0xFF80);
+
+	ascii = _mm_andnot_si128(_mm_cmpeq_epi16(va, zero),
+		_mm_cmpeq_epi16(_mm_and_si128(va, hi), zero));
+	ascii = _mm_and_si128(ascii, _mm_andnot_si128(_mm_cmpeq_epi16(vb, zero),
+		_mm_cmpeq_epi16(_mm_and_si128(vb, hi), zero)));
+
+	/* signed compares are fine here, only ASCII lanes are kept */
+	upper = _mm_and_si128(_mm_cmpgt_epi16(va, _mm_set1_epi16('A' - 1)),
+		_mm_cmplt_epi16(va, _mm_set1_epi16('Z' + 1)));
+	fa = _mm_add_epi16(va, _mm_and_si128(upper, _mm_set1_epi16(0x20)));
+	upper = _mm_and_si128(_mm_cmpgt_epi16(vb, _mm_set1_epi16('A' - 1)),
+		_mm_cmplt_epi16(vb, _mm_set1_epi16('Z' + 1)));
+	fb = _mm_add_epi16(vb, _mm_and_si128(upper, _mm_set1_epi16(0x20)));
+
+	mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(fa, fb), ascii));
+	if (mask == 0xFFFF)
+		return 8;
+	return __builtin_ctz(~mask) / 2;
+#elif defined(HFS_SIMD_NEON)
+	uint16x8_t	va, vb, ascii, fa, fb;
+	uint64_t	mask;
+
+	va = vld1q_u16(a);
+	vb = vld1q_u16(b);
+
+	ascii = vandq_u16(
+		vcltq_u16(vsubq_u16(va, vdupq_n_u16(1)), vdupq_n_u16(0x7F)),
+		vcltq_u16(vsubq_u16(vb, vdupq_n_u16(1)), vdupq_n_u16(0x7F)));
+	fa = vaddq_u16(va, vandq_u16(vdupq_n_u16(0x20),
+		vcltq_u16(vsubq_u16(va, vdupq_n_u16('A')), vdupq_n_u16(26))));
+	fb = vaddq_u16(vb, vandq_u16(vdupq_n_u16(0x20),
+		vcltq_u16(vsubq_u16(vb, vdupq_n_u16('A')), vdupq_n_u16(26))));
+
+	mask = vget_lane_u64(vreinterpret_u64_u8(
+		vmovn_u16(vandq_u16(vceqq_u16(fa, fb), ascii))), 0);
+	if (mask == UINT64_MAX)
+		return 8;
+	return __builtin_ctzll(~mask) / 8;
+#else
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		if (!HFS_IS_ASCII(a[i]) || !HFS_IS_ASCII(b[i]) ||
+		    HFS_FOLD_ASCII(a[i]) != HFS_FOLD_ASCII(b[i]))
+			break;
+	}
+	return i;
+#endif
+}
+
+/*
+ * Implements the name comparison pseudocode suggested by the HFS+ technote.
+ * If a_folded is set, a has already been through hfslib_fold_catalog_key()
+ * and only b is folded here.
+ */
+static inline int
+hfs_compare_names_cf(
+	const hfs_unistr255_t* a,
+	const hfs_unistr255_t* b,
+	int a_folded)
+{
+	unichar_t	ac, bc; /* current folded character from a, b */
+	uint8_t		apos, bpos; /* current character indices */
+	int			n;
+
+	/*
+	 * Keys being compared mostly share a prefix, so skip over as much of it
+	 * as is ASCII in one go. Past the first difference or non-ASCII
+	 * character the table is used for the rest, as retrying costs more than
+	 * it saves on names that are mostly not ASCII.
+	 */
+	apos = bpos = 0;
+	while (apos + 8 <= a->length && bpos + 8 <= b->length &&
+	    HFS_IS_ASCII(a->unicode[apos]) && HFS_IS_ASCII(b->unicode[bpos])) {
+		n = hfs_fold_ascii_prefix8(&a->unicode[apos], &b->unicode[bpos]);
+		apos += n;
+		bpos += n;
+		if (n < 8)
+			break;
+	}
+
+	while (1)
+	{
+		/* get next valid character from a */
+		for (ac = 0; ac == 0 && apos < a->length; apos++)
+			ac = a_folded ? a->unicode[apos] :
+				hfs_fold_char(a->unicode[apos]);
+
+		/* get next valid character from b */
+		for (bc = 0; bc == 0 && bpos < b->length; bpos++)
+			bc = hfs_fold_char(b->unicode[bpos]);
+
+		/* on end of string ac/bc are 0, otherwise > 0 */
+		if (ac != bc || (ac == 0 && bc == 0))
+			return ac - bc;
+	}
+}
+
 /* case-folding */
 int
 hfslib_compare_catalog_keys_cf (
@@ -2992,59 +4027,59 @@ hfslib_compare_catalog_keys_cf (
 	const void *bp)
 {
 	const hfs_catalog_key_t	*a, *b;
-	unichar_t	ac, bc; /* current character from a, b */
-	unichar_t	lc; /* lowercase version of current character */
-	uint8_t		apos, bpos; /* current character indices */
 
 	a = (const hfs_catalog_key_t*)ap;
 	b = (const hfs_catalog_key_t*)bp;
 
-	if (a->parent_cnid != b->parent_cnid) {
+	if (a->parent_cnid != b->parent_cnid)
 		return (a->parent_cnid - b->parent_cnid);
-	} else {
-		/*
-		 * The following code implements the pseudocode suggested by
-		 * the HFS+ technote.
-		 */
+
+	return hfs_compare_names_cf(&a->name, &b->name, 0);
+}
 
 /*
- * XXX These need to be revised to be endian-independent!
+ * Like hfslib_compare_catalog_keys_cf(), but a must have been produced by
+ * hfslib_fold_catalog_key(). Lookups that compare one key against many
+ * records fold it once up front this way.
  */
-#define hbyte(x) ((x) >> 8)
-#define lbyte(x) ((x) & 0x00FF)
+int
+hfslib_compare_catalog_keys_cf_folded (
+	const void *ap,
+	const void *bp)
+{
+	const hfs_catalog_key_t	*a, *b;
 
-		apos = bpos = 0;
-		while (1)
-		{
-			/* get next valid character from a */
-			for (lc = 0; lc == 0 && apos < a->name.length; apos++) {
-				ac = a->name.unicode[apos];
-				lc = hfs_gcft[hbyte(ac)];
-				if (lc == 0)
-					lc = ac;
-				else
-					lc = hfs_gcft[lc + lbyte(ac)];
-			};
-			ac = lc;
-
-			/* get next valid character from b */
-			for (lc = 0; lc == 0 && bpos < b->name.length; bpos++) {
-				bc = b->name.unicode[bpos];
-				lc = hfs_gcft[hbyte(bc)];
-				if (lc == 0)
-					lc = bc;
-				else
-					lc = hfs_gcft[lc + lbyte(bc)];
-			};
-			bc = lc;
-
-			/* on end of string ac/bc are 0, otherwise > 0 */
-			if (ac != bc || (ac == 0 && bc == 0))
-				return ac - bc;
-		}
-#undef hbyte
-#undef lbyte
+	a = (const hfs_catalog_key_t*)ap;
+	b = (const hfs_catalog_key_t*)bp;
+
+	if (a->parent_cnid != b->parent_cnid)
+		return (a->parent_cnid - b->parent_cnid);
+
+	return hfs_compare_names_cf(&a->name, &b->name, 1);
+}
+
+/*
+ * Stores the case folded form of in_key in out_key, dropping ignorable
+ * characters, for use with hfslib_compare_catalog_keys_cf_folded().
+ */
+void
+hfslib_fold_catalog_key(
+	const hfs_catalog_key_t* in_key,
+	hfs_catalog_key_t* out_key)
+{
+	unichar_t	c;
+	uint16_t	i, len;
+
+	len = 0;
+	for (i = 0; i < in_key->name.length && i < 255; i++) {
+		c = hfs_fold_char(in_key->name.unicode[i]);
+		if (c != 0)
+			out_key->name.unicode[len++] = c;
 	}
+
+	out_key->name.length = len;
+	out_key->parent_cnid = in_key->parent_cnid;
+	out_key->key_len = 6 + 2 * len;
 }
 
 static int
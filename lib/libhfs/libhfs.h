@@ -503,6 +503,17 @@ typedef struct {
 									 * bytes (1 or 2); always 2 for HFS+ */
 	hfs_unistr255_t		name;	/* volume name */
 
+	/*
+	 * full extent lists of the special B-tree files, resolved once at open
+	 * time (including any overflow extents) and freed on close
+	 */
+	hfs_extent_descriptor_t*	catextents;	/* catalog file */
+	hfs_extent_descriptor_t*	extextents;	/* extents overflow file */
+	hfs_extent_descriptor_t*	attrextents;	/* attributes file */
+	uint16_t	numcatextents;
+	uint16_t	numextextents;
+	uint16_t	numattrextents;
+
 	/* pointer to catalog file key comparison function */
 	int (*keycmp) (const void*, const void*);
 
@@ -517,6 +528,38 @@ typedef struct {
 						 * callback routines */
 } hfs_volume;
 
+/*
+ * A b-tree index or leaf node whose records are accessed in place, see
+ * hfslib_read_node_view()
+ */
+typedef struct {
+	hfs_node_descriptor_t	nd;		/* node descriptor */
+	void*		node;		/* node contents */
+	uint16_t	node_size;
+	hfs_btree_file_type	file;	/* b-tree the node belongs to */
+} hfs_node_view_t;
+
+/*
+ * Position in the listing of a folder's children, see hfslib_open_directory()
+ */
+typedef struct {
+	hfs_cnid_t	parent;		/* CNID of the folder being listed */
+	uint32_t	node;		/* catalog leaf node being read */
+	uint16_t	recnum;		/* next record to read in node */
+	void*		buffer;		/* contents of node, NULL once done */
+	hfs_node_view_t	view;	/* view of buffer */
+} hfs_dir_cursor_t;
+
+/*
+ * Attributes b-tree leaf kept between lookups, see
+ * hfslib_find_attribute_record_near()
+ */
+typedef struct {
+	uint32_t	node;		/* attributes leaf node held, 0 if none */
+	void*		buffer;		/* contents of node, NULL if none */
+	hfs_node_view_t	view;	/* view of buffer */
+} hfs_attribute_cursor_t;
+
 typedef union {
 	/* for leaf nodes */
 	int16_t					type; /* type of record: folder, file, or thread */
@@ -561,6 +604,13 @@ typedef struct {
 	void*	read;
 } hfs_callback_args;
 
+/* a run of bytes at an offset into the volume, for the readv callback */
+typedef struct {
+	void*		buffer;
+	uint64_t	length;
+	uint64_t	offset;
+} hfs_io_segment_t;
+
 typedef struct {
 	/* error(in_format, in_file, in_line, in_args) */
 	void (*error) (const char*, const char*, int, va_list);
@@ -585,6 +635,31 @@ typedef struct {
 	 * returns 0 on success */
 	int (*read) (hfs_volume*, void*, uint64_t, uint64_t,
 		hfs_callback_args*);
+
+	/* The node cache callbacks are optional; if getnode is NULL every b-tree
+	 * node is read from disk into a fresh buffer and freed after use. */
+
+	/* getnode(in_volume, in_file, in_node, cbargs)
+	 * returns the contents of a cached b-tree node, or NULL if not cached */
+	void* (*getnode) (hfs_volume*, hfs_btree_file_type, uint32_t,
+		hfs_callback_args*);
+
+	/* putnode(in_volume, in_file, in_node, in_buffer, cbargs)
+	 * offers a node just read into an allocmem'd buffer to the cache, which
+	 * takes ownership of it. returns the buffer to use in its place */
+	void* (*putnode) (hfs_volume*, hfs_btree_file_type, uint32_t, void*,
+		hfs_callback_args*);
+
+	/* releasenode(in_volume, in_file, in_node, in_buffer, cbargs)
+	 * called once for every buffer returned by getnode or putnode */
+	void (*releasenode) (hfs_volume*, hfs_btree_file_type, uint32_t, void*,
+		hfs_callback_args*);
+
+	/* readv(in_volume, in_segments, in_count, cbargs)
+	 * optional; reads every segment as one batch. if NULL each segment is
+	 * passed to read instead. returns 0 on success */
+	int (*readv) (hfs_volume*, const hfs_io_segment_t*, uint32_t,
+		hfs_callback_args*);
 } hfs_callbacks;
 
 extern hfs_callbacks	hfs_gcb;	/* global callbacks */
@@ -619,8 +694,24 @@ int hfslib_find_extent_record_with_key(hfs_volume*, hfs_extent_key_t*,
 	hfs_extent_record_t*, hfs_callback_args*);
 int hfslib_find_attribute_record_with_key(hfs_volume*, hfs_attribute_key_t*,
 	hfs_attribute_record_t*, void**, hfs_callback_args*);
+int hfslib_find_attribute_record_near(hfs_volume*, hfs_attribute_cursor_t*,
+	hfs_attribute_key_t*, hfs_attribute_record_t*, void**,
+	hfs_callback_args*);
+void hfslib_close_attribute_cursor(hfs_volume*, hfs_attribute_cursor_t*,
+	hfs_callback_args*);
 int hfslib_find_attribute_records_for_cnid(hfs_volume*, hfs_cnid_t,
 	hfs_attribute_key_t**, uint32_t*, hfs_callback_args*);
+int hfslib_open_directory(hfs_volume*, hfs_cnid_t, hfs_dir_cursor_t*,
+	hfs_callback_args*);
+int hfslib_seek_directory(hfs_volume*, hfs_dir_cursor_t*,
+	const hfs_catalog_key_t*, hfs_callback_args*);
+int hfslib_read_directory(hfs_volume*, hfs_dir_cursor_t*,
+	hfs_catalog_keyed_record_t*, hfs_catalog_key_t*, hfs_callback_args*);
+uint64_t hfslib_tell_directory(const hfs_dir_cursor_t*);
+int hfslib_seek_directory_position(hfs_volume*, hfs_dir_cursor_t*, uint64_t,
+	hfs_callback_args*);
+void hfslib_close_directory(hfs_volume*, hfs_dir_cursor_t*,
+	hfs_callback_args*);
 int hfslib_get_directory_contents(hfs_volume*, hfs_cnid_t,
 	hfs_catalog_keyed_record_t**, hfs_unistr255_t**, uint32_t*,
 	hfs_callback_args*);
@@ -646,6 +737,11 @@ size_t hfslib_read_extent_record(void*, hfs_extent_record_t*, hfs_node_kind,
 	hfs_extent_key_t*, hfs_volume*);
 size_t hfslib_read_attribute_record(void*, size_t, hfs_node_kind,
 	hfs_attribute_record_t*, hfs_attribute_key_t*, void**, hfs_volume*);
+int hfslib_read_node_view(void*, hfs_btree_file_type, hfs_volume*,
+	hfs_node_view_t*);
+void* hfslib_get_node_record(const hfs_node_view_t*, uint16_t, uint16_t*);
+int hfslib_search_node(hfs_volume*, const hfs_node_view_t*, const void*,
+	int (*)(const void*, const void*), void*, int*);
 
 void hfslib_free_recs(void***, uint16_t**, uint16_t*, hfs_callback_args*);
 
@@ -668,13 +764,26 @@ uint16_t hfslib_make_attribute_key(hfs_cnid_t, uint32_t, uint16_t, unichar_t*,
 	hfs_attribute_key_t*);
 uint16_t hfslib_get_file_extents(hfs_volume*, hfs_cnid_t, uint8_t,
 	hfs_extent_descriptor_t**, hfs_callback_args*);
+uint16_t hfslib_get_fork_extents(hfs_volume*, hfs_cnid_t, uint8_t,
+	const hfs_fork_t*, hfs_extent_descriptor_t**, hfs_callback_args*);
 int hfslib_get_attribute_extents(hfs_volume*, hfs_attribute_key_t*,
 	hfs_attribute_record_t*, uint16_t*, hfs_extent_descriptor_t**,
 	hfs_callback_args*);
 int hfslib_readd_with_extents(hfs_volume*, void*, uint64_t*, uint64_t,
 	uint64_t, hfs_extent_descriptor_t*, uint16_t, hfs_callback_args*);
+int hfslib_readd_with_extent_offsets(hfs_volume*, void*, uint64_t*, uint64_t,
+	uint64_t, hfs_extent_descriptor_t*, const uint64_t*, uint16_t,
+	hfs_callback_args*);
+int hfslib_get_extent_offsets(hfs_volume*, const hfs_extent_descriptor_t*,
+	uint16_t, uint64_t**, hfs_callback_args*);
+int hfslib_get_node(hfs_volume*, hfs_btree_file_type, uint32_t,
+	hfs_extent_descriptor_t*, uint16_t, void**, hfs_callback_args*);
+void hfslib_release_node(hfs_volume*, hfs_btree_file_type, uint32_t, void*,
+	hfs_callback_args*);
 
 int hfslib_compare_catalog_keys_cf(const void*, const void*);
+int hfslib_compare_catalog_keys_cf_folded(const void*, const void*);
+void hfslib_fold_catalog_key(const hfs_catalog_key_t*, hfs_catalog_key_t*);
 int hfslib_compare_catalog_keys_bc(const void*, const void*);
 int hfslib_compare_extent_keys(const void*, const void*);
 int hfslib_compare_attribute_keys(const hfs_attribute_key_t*,
@@ -689,5 +798,7 @@ void hfslib_free(void*, hfs_callback_args*);
 int hfslib_openvoldevice(hfs_volume*, const char*, hfs_callback_args*);
 void hfslib_closevoldevice(hfs_volume*, hfs_callback_args*);
 int hfslib_readd(hfs_volume*, void*, uint64_t, uint64_t, hfs_callback_args*);
+int hfslib_readdv(hfs_volume*, const hfs_io_segment_t*, uint32_t,
+	hfs_callback_args*);
 
 #endif /* !_FS_HFS_LIBHFS_H_ */
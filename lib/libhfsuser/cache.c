@@ -6,102 +6,642 @@
 #include "cache.h"
 
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 #include <pthread.h>
 
-struct ringnode {
-	struct ringnode* next,* prev;
-	char* path;
+// path record cache
+// paths are hashed into a fixed number of shards, each with its own lock, hash table and LRU list so that lookups
+// from different threads rarely contend. entries are allocated as they are first needed and reused once a shard is full
+// the same structure also serves as the dentry cache, mapping a parent cnid and name to a record, and with no value
+// stored as the negative lookup cache. keyed by cnid alone it holds the results of decmpfs lookups
+
+#define RECORD_CACHE_SHARDS 16
+
+struct record_link {
+	struct record_link* next,* prev;
+};
+
+struct record_entry {
+	struct record_link lru; // must be first
+	struct record_entry* hnext; // hash chain
+	uint64_t hash;
 	size_t len;
-	hfs_catalog_keyed_record_t record;
+	unsigned char data[]; // value followed by key
+};
+
+struct record_shard {
+	pthread_mutex_t lock;
+	struct record_link lru; // list head, most recently used first
+	struct record_entry** buckets;
+	size_t nbuckets;
+	size_t count, capacity;
+	uint64_t hits, misses, evictions;
 };
 
 struct hfs_record_cache {
-	pthread_rwlock_t lock;
-	struct ringnode* head;
-	struct ringnode backing[];
+	size_t valsize;
+	size_t nshards;
+	struct record_shard shards[];
 };
 
-struct hfs_record_cache* hfs_record_cache_create(size_t length) {
+// FNV-1a, with a final mix so that paths differing only in their last few characters spread across shards
+static inline uint64_t record_hash(const void* key, size_t len) {
+	uint64_t h = UINT64_C(14695981039346656037);
+	for(size_t i = 0; i < len; i++)
+		h = (h ^ ((const unsigned char*)key)[i]) * UINT64_C(1099511628211);
+	h ^= h >> 33;
+	h *= UINT64_C(0xff51afd7ed558ccd);
+	return h ^ (h >> 33);
+}
+
+static inline struct record_shard* record_get_shard(struct hfs_record_cache* c, uint64_t hash) {
+	return c->shards + ((hash >> 32) & (c->nshards - 1));
+}
+
+static inline struct record_entry** record_bucket(struct record_shard* s, uint64_t hash) {
+	return s->buckets + (hash & (s->nbuckets - 1));
+}
+
+static inline struct record_entry* record_find(struct hfs_record_cache* c, struct record_shard* s, uint64_t hash, const void* key, size_t len) {
+	struct record_entry* e = *record_bucket(s, hash);
+	while(e && (e->hash != hash || e->len != len || memcmp(e->data + c->valsize, key, len)))
+		e = e->hnext;
+	return e;
+}
+
+static inline void record_unlink(struct record_entry* e) {
+	e->lru.prev->next = e->lru.next;
+	e->lru.next->prev = e->lru.prev;
+}
+
+static inline void record_push(struct record_shard* s, struct record_entry* e) {
+	e->lru.next = s->lru.next;
+	e->lru.prev = &s->lru;
+	s->lru.next->prev = &e->lru;
+	s->lru.next = &e->lru;
+}
+
+static void record_unhash(struct record_shard* s, struct record_entry* e) {
+	struct record_entry** it = record_bucket(s, e->hash);
+	while(*it != e)
+		it = &(*it)->hnext;
+	*it = e->hnext;
+}
+
+static struct hfs_record_cache* record_cache_create(size_t length, size_t valsize) {
 	if(!length)
 		return NULL;
-	struct hfs_record_cache* buf = malloc(sizeof(*buf) + sizeof(*buf->backing)*length);
-	if(!buf || pthread_rwlock_init(&buf->lock,NULL)) {
-		free(buf);
+	// small caches use fewer shards, since entries can't move between shards and uneven hashing wastes capacity
+	size_t nshards = RECORD_CACHE_SHARDS;
+	while(nshards > 1 && length / nshards < 64)
+		nshards >>= 1;
+	struct hfs_record_cache* c = calloc(1, sizeof(*c) + sizeof(*c->shards)*nshards);
+	if(!c)
 		return NULL;
+	for(size_t i = 0; i < nshards; i++) {
+		struct record_shard* s = c->shards + i;
+		s->capacity = length / nshards + (i < length % nshards);
+		s->nbuckets = 1;
+		while(s->nbuckets < s->capacity)
+			s->nbuckets <<= 1;
+		s->lru.next = s->lru.prev = &s->lru;
+		if(!(s->buckets = calloc(s->nbuckets, sizeof(*s->buckets))) || pthread_mutex_init(&s->lock, NULL)) {
+			free(s->buckets);
+			c->nshards = i;
+			hfs_record_cache_destroy(c);
+			return NULL;
+		}
 	}
+	c->nshards = nshards;
+	c->valsize = valsize;
+	return c;
+}
+
+struct hfs_record_cache* hfs_record_cache_create(size_t length) {
+	return record_cache_create(length, sizeof(hfs_catalog_keyed_record_t));
+}
 
-	struct ringnode* tail = buf->head = buf->backing;
-	for(size_t i = 0; i <= length; i++) {
-		tail->next = buf->backing + i%length;
-		tail->next->prev = tail;
-		tail = tail->next;
-		tail->path = NULL;
+void hfs_record_cache_destroy(struct hfs_record_cache* c) {
+	if(!c)
+		return;
+	for(size_t i = 0; i < c->nshards; i++) {
+		struct record_shard* s = c->shards + i;
+		for(struct record_link* l = s->lru.next,* next; l != &s->lru; l = next) {
+			next = l->next;
+			free(l);
+		}
+		pthread_mutex_destroy(&s->lock);
+		free(s->buckets);
 	}
-	return buf;
+	free(c);
 }
 
-void hfs_record_cache_destroy(struct hfs_record_cache* buf) {
-	if(!buf)
+static bool record_cache_lookup(struct hfs_record_cache* c, const void* key, size_t len, void* value) {
+	if(!c)
+		return false;
+	uint64_t hash = record_hash(key, len);
+	struct record_shard* s = record_get_shard(c, hash);
+	if(pthread_mutex_lock(&s->lock))
+		return false;
+	struct record_entry* e = record_find(c, s, hash, key, len);
+	if(e) {
+		record_unlink(e);
+		record_push(s, e);
+		if(c->valsize)
+			memcpy(value, e->data, c->valsize);
+		s->hits++;
+	}
+	else s->misses++;
+	pthread_mutex_unlock(&s->lock);
+	return e != NULL;
+}
+
+static void record_cache_add(struct hfs_record_cache* c, const void* key, size_t len, const void* value) {
+	if(!c)
 		return;
-    pthread_rwlock_wrlock(&buf->lock);
-	struct ringnode* tail = buf->head;
-	do {
-		free(tail->path);
-		tail = tail->next;
-	} while(tail != buf->head);
-	pthread_rwlock_unlock(&buf->lock);
-	pthread_rwlock_destroy(&buf->lock);
-	free(buf);
-}
-
-bool hfs_record_cache_lookup(struct hfs_record_cache* buf, const char* path, size_t len, hfs_catalog_keyed_record_t* record) {
-	bool ret = false;
-	if(!buf || pthread_rwlock_rdlock(&buf->lock))
-		return ret;
-	struct ringnode* it = buf->head;
-	do {
-		if(!it->path) break;
-		if(len == it->len && !memcmp(it->path,path,len)) {
-			*record = it->record;
-			ret = true;
-			break;
+	uint64_t hash = record_hash(key, len);
+	struct record_shard* s = record_get_shard(c, hash);
+	if(pthread_mutex_lock(&s->lock))
+		return;
+	struct record_entry* e = record_find(c, s, hash, key, len);
+	if(e) {
+		// another thread looked up the same key
+		if(c->valsize)
+			memcpy(e->data, value, c->valsize);
+		record_unlink(e);
+		record_push(s, e);
+		goto end;
+	}
+
+	if(s->count < s->capacity) {
+		if(!(e = malloc(sizeof(*e) + c->valsize + len)))
+			goto end;
+		s->count++;
+	}
+	else {
+		// reuse the least recently used entry
+		struct record_entry* old = (struct record_entry*)s->lru.prev;
+		record_unhash(s, old);
+		record_unlink(old);
+		s->evictions++;
+		if(old->len != len && !(e = realloc(old, sizeof(*e) + c->valsize + len))) {
+			free(old);
+			s->count--;
+			goto end;
 		}
-		it = it->next;
-	} while(it != buf->head);
-	pthread_rwlock_unlock(&buf->lock);
-	return ret;
+		else if(!e)
+			e = old;
+	}
+
+	if(c->valsize)
+		memcpy(e->data, value, c->valsize);
+	memcpy(e->data + c->valsize, key, len);
+	e->hash = hash;
+	e->len = len;
+	struct record_entry** bucket = record_bucket(s, hash);
+	e->hnext = *bucket;
+	*bucket = e;
+	record_push(s, e);
+end:
+	pthread_mutex_unlock(&s->lock);
 }
 
-size_t hfs_record_cache_lookup_parents(struct hfs_record_cache* buf, char* path, size_t len, hfs_catalog_keyed_record_t* record) {
+bool hfs_record_cache_lookup(struct hfs_record_cache* c, const char* path, size_t len, hfs_catalog_keyed_record_t* record) {
+	return record_cache_lookup(c, path, len, record);
+}
+
+size_t hfs_record_cache_lookup_parents(struct hfs_record_cache* c, char* path, size_t len, hfs_catalog_keyed_record_t* record) {
 	len = 0;
-	char* c;
-	while((c = strrchr(path, '/'))) {
-		*c = '\0';
-		len = c - path;
-		if(*path && hfs_record_cache_lookup(buf, path, len, record))
+	char* p;
+	while((p = strrchr(path, '/'))) {
+		*p = '\0';
+		len = p - path;
+		if(*path && hfs_record_cache_lookup(c, path, len, record))
 			break;
 	}
 	return len;
 }
 
-void hfs_record_cache_add(struct hfs_record_cache* buf, const char* path, size_t len, hfs_catalog_keyed_record_t* record) {
-	if(!buf || pthread_rwlock_wrlock(&buf->lock))
+void hfs_record_cache_add(struct hfs_record_cache* c, const char* path, size_t len, hfs_catalog_keyed_record_t* record) {
+	record_cache_add(c, path, len, record);
+}
+
+static inline size_t dentry_key(unsigned char* key, hfs_cnid_t parent, const hfs_unistr255_t* name) {
+	size_t len = min(name->length, 255) * sizeof(unichar_t);
+	memcpy(key, &parent, sizeof(parent));
+	memcpy(key + sizeof(parent), name->unicode, len);
+	return sizeof(parent) + len;
+}
+
+struct hfs_record_cache* hfs_dentry_cache_create(size_t length) {
+	return record_cache_create(length, sizeof(hfs_catalog_keyed_record_t));
+}
+
+bool hfs_dentry_cache_lookup(struct hfs_record_cache* c, hfs_cnid_t parent, const hfs_unistr255_t* name, hfs_catalog_keyed_record_t* record) {
+	unsigned char key[sizeof(hfs_cnid_t) + sizeof(name->unicode)];
+	return c && record_cache_lookup(c, key, dentry_key(key, parent, name), record);
+}
+
+void hfs_dentry_cache_add(struct hfs_record_cache* c, hfs_cnid_t parent, const hfs_unistr255_t* name, hfs_catalog_keyed_record_t* record) {
+	unsigned char key[sizeof(hfs_cnid_t) + sizeof(name->unicode)];
+	if(c)
+		record_cache_add(c, key, dentry_key(key, parent, name), record);
+}
+
+struct hfs_record_cache* hfs_negative_cache_create(size_t length) {
+	return record_cache_create(length, 0);
+}
+
+bool hfs_negative_cache_lookup(struct hfs_record_cache* c, hfs_cnid_t parent, const hfs_unistr255_t* name) {
+	unsigned char key[sizeof(hfs_cnid_t) + sizeof(name->unicode)];
+	return c && record_cache_lookup(c, key, dentry_key(key, parent, name), NULL);
+}
+
+void hfs_negative_cache_add(struct hfs_record_cache* c, hfs_cnid_t parent, const hfs_unistr255_t* name) {
+	unsigned char key[sizeof(hfs_cnid_t) + sizeof(name->unicode)];
+	if(c)
+		record_cache_add(c, key, dentry_key(key, parent, name), NULL);
+}
+
+struct hfs_record_cache* hfs_decmpfs_cache_create(size_t length) {
+	return record_cache_create(length, sizeof(struct hfs_decmpfs_cache_value));
+}
+
+bool hfs_decmpfs_cache_lookup(struct hfs_record_cache* c, hfs_cnid_t cnid, struct hfs_decmpfs_cache_value* value) {
+	return record_cache_lookup(c, &cnid, sizeof(cnid), value);
+}
+
+void hfs_decmpfs_cache_add(struct hfs_record_cache* c, hfs_cnid_t cnid, const struct hfs_decmpfs_cache_value* value) {
+	record_cache_add(c, &cnid, sizeof(cnid), value);
+}
+
+void hfs_record_cache_stats(struct hfs_record_cache* c, struct hfs_record_cache_stats* stats) {
+	*stats = (struct hfs_record_cache_stats){0};
+	if(!c)
 		return;
-	struct ringnode* tail = buf->head->prev;
-	char* newpath = realloc(tail->path,len);
-	if(!newpath) {
-		do {
-			free(tail->path);
-			tail->path = NULL;
-			tail = tail->next;
-		} while(tail != buf->head->prev);
+	for(size_t i = 0; i < c->nshards; i++) {
+		struct record_shard* s = c->shards + i;
+		if(pthread_mutex_lock(&s->lock))
+			continue;
+		stats->hits += s->hits;
+		stats->misses += s->misses;
+		stats->evictions += s->evictions;
+		stats->records += s->count;
+		stats->capacity += s->capacity;
+		pthread_mutex_unlock(&s->lock);
+	}
+}
+
+// B-tree node cache
+// nodes are kept in one of two LRU lists depending on their kind so that index nodes, which are visited by every search, can be retained preferentially over leaves
+// buffers handed out by lookup or add are reference counted and never evicted while in use
+
+enum { NODE_LRU_LEAF, NODE_LRU_INDEX };
+
+struct node_entry {
+	struct node_entry* hnext; // hash chain or free list
+	struct node_entry* next,* prev; // LRU
+	void* data;
+	uint32_t node;
+	uint32_t refs;
+	uint8_t file;
+	uint8_t lru;
+};
+
+struct hfs_node_cache {
+	pthread_mutex_t lock;
+	struct node_entry lrus[2]; // list heads
+	size_t lru_len[2];
+	struct node_entry* free;
+	struct node_entry** buckets;
+	size_t nbuckets;
+	size_t capacity;
+	uint64_t hits, misses, evictions;
+	struct node_entry backing[];
+};
+
+struct hfs_node_cache* hfs_node_cache_create(size_t length) {
+	if(!length)
+		return NULL;
+	struct hfs_node_cache* c = calloc(1, sizeof(*c) + sizeof(*c->backing)*length);
+	if(!c)
+		return NULL;
+	c->nbuckets = 1;
+	while(c->nbuckets < length)
+		c->nbuckets <<= 1;
+	if(!(c->buckets = calloc(c->nbuckets, sizeof(*c->buckets))) || pthread_mutex_init(&c->lock, NULL)) {
+		free(c->buckets);
+		free(c);
+		return NULL;
+	}
+	c->capacity = length;
+	for(int i = 0; i < 2; i++)
+		c->lrus[i].next = c->lrus[i].prev = &c->lrus[i];
+	for(size_t i = 0; i < length; i++) {
+		c->backing[i].hnext = c->free;
+		c->free = c->backing + i;
+	}
+	return c;
+}
+
+void hfs_node_cache_destroy(struct hfs_node_cache* c) {
+	if(!c)
+		return;
+	for(size_t i = 0; i < c->capacity; i++)
+		free(c->backing[i].data);
+	pthread_mutex_destroy(&c->lock);
+	free(c->buckets);
+	free(c);
+}
+
+static inline struct node_entry** node_bucket(struct hfs_node_cache* c, uint8_t file, uint32_t node) {
+	return c->buckets + (((node * UINT32_C(2654435761)) ^ file) & (c->nbuckets - 1));
+}
+
+static inline struct node_entry* node_find(struct hfs_node_cache* c, uint8_t file, uint32_t node) {
+	struct node_entry* e = *node_bucket(c, file, node);
+	while(e && (e->node != node || e->file != file))
+		e = e->hnext;
+	return e;
+}
+
+static inline void node_unlink(struct hfs_node_cache* c, struct node_entry* e) {
+	e->prev->next = e->next;
+	e->next->prev = e->prev;
+	c->lru_len[e->lru]--;
+}
+
+static inline void node_push(struct hfs_node_cache* c, struct node_entry* e) {
+	struct node_entry* head = &c->lrus[e->lru];
+	e->next = head->next;
+	e->prev = head;
+	head->next->prev = e;
+	head->next = e;
+	c->lru_len[e->lru]++;
+}
+
+static struct node_entry* node_evict(struct hfs_node_cache* c, int lru) {
+	struct node_entry* head = &c->lrus[lru];
+	for(struct node_entry* e = head->prev; e != head; e = e->prev) {
+		if(e->refs)
+			continue;
+		struct node_entry** it = node_bucket(c, e->file, e->node);
+		while(*it != e)
+			it = &(*it)->hnext;
+		*it = e->hnext;
+		node_unlink(c, e);
+		free(e->data);
+		e->data = NULL;
+		c->evictions++;
+		return e;
+	}
+	return NULL;
+}
+
+void* hfs_node_cache_lookup(struct hfs_node_cache* c, uint8_t file, uint32_t node) {
+	if(!c || pthread_mutex_lock(&c->lock))
+		return NULL;
+	void* ret = NULL;
+	struct node_entry* e = node_find(c, file, node);
+	if(e) {
+		e->refs++;
+		node_unlink(c, e);
+		node_push(c, e);
+		ret = e->data;
+		c->hits++;
+	}
+	else c->misses++;
+	pthread_mutex_unlock(&c->lock);
+	return ret;
+}
+
+void* hfs_node_cache_add(struct hfs_node_cache* c, uint8_t file, uint32_t node, void* data) {
+	if(!c || pthread_mutex_lock(&c->lock))
+		return data;
+	struct node_entry* e = node_find(c, file, node);
+	if(e) {
+		// raced with another reader of this node, use theirs
+		free(data);
+		e->refs++;
+		node_unlink(c, e);
+		node_push(c, e);
+		data = e->data;
 		goto end;
 	}
-	memcpy(newpath, path,len);
-	tail->path = newpath;
-	tail->len = len;
-	tail->record = *record;
-	buf->head = tail;
+
+	// descriptor kind is the int8 at offset 8
+	int lru = ((int8_t*)data)[8] == HFS_INDEXNODE ? NODE_LRU_INDEX : NODE_LRU_LEAF;
+	if((e = c->free))
+		c->free = e->hnext;
+	// leaves are evicted before index nodes unless index nodes have taken over most of the cache
+	else if(c->lru_len[NODE_LRU_INDEX] > c->capacity / 4 * 3 || !(e = node_evict(c, NODE_LRU_LEAF)))
+		e = node_evict(c, NODE_LRU_INDEX);
+	if(!e && !(e = node_evict(c, NODE_LRU_LEAF)))
+		goto end; // everything is in use, caller keeps an uncached buffer
+
+	e->data = data;
+	e->file = file;
+	e->node = node;
+	e->refs = 1;
+	e->lru = lru;
+	struct node_entry** bucket = node_bucket(c, file, node);
+	e->hnext = *bucket;
+	*bucket = e;
+	node_push(c, e);
 end:
-	pthread_rwlock_unlock(&buf->lock);
+	pthread_mutex_unlock(&c->lock);
+	return data;
+}
+
+void hfs_node_cache_release(struct hfs_node_cache* c, uint8_t file, uint32_t node, void* data) {
+	if(!c || pthread_mutex_lock(&c->lock)) {
+		free(data);
+		return;
+	}
+	struct node_entry* e = node_find(c, file, node);
+	if(e && e->data == data)
+		e->refs--;
+	else free(data);
+	pthread_mutex_unlock(&c->lock);
+}
+
+void hfs_node_cache_stats(struct hfs_node_cache* c, struct hfs_node_cache_stats* stats) {
+	*stats = (struct hfs_node_cache_stats){0};
+	if(!c || pthread_mutex_lock(&c->lock))
+		return;
+	stats->hits = c->hits;
+	stats->misses = c->misses;
+	stats->evictions = c->evictions;
+	stats->nodes = c->lru_len[NODE_LRU_LEAF] + c->lru_len[NODE_LRU_INDEX];
+	stats->capacity = c->capacity;
+	pthread_mutex_unlock(&c->lock);
+}
+
+// directory listing cache
+// listings are immutable once cached and shared by reference, so like nodes they're never evicted while in use
+// the cache is bounded both by the number of listings and by the memory they take up
+
+struct dir_entry {
+	struct hfs_dir_listing listing; // must be first, handed out to callers
+	struct dir_entry* hnext; // hash chain
+	struct dir_entry* next,* prev; // LRU
+	hfs_cnid_t cnid;
+	uint32_t refs;
+	size_t bytes;
+};
+
+struct hfs_dir_cache {
+	pthread_mutex_t lock;
+	struct dir_entry lru; // list head, most recently used first
+	struct dir_entry** buckets;
+	size_t nbuckets;
+	size_t count, capacity;
+	size_t bytes, max_bytes;
+	uint64_t hits, misses, evictions;
+};
+
+static inline size_t dir_listing_bytes(const struct hfs_dir_listing* l) {
+	return sizeof(struct dir_entry) + l->count * sizeof(*l->entries) + l->names_size;
+}
+
+struct hfs_dir_cache* hfs_dir_cache_create(size_t length, size_t max_bytes) {
+	if(!length || !max_bytes)
+		return NULL;
+	struct hfs_dir_cache* c = calloc(1, sizeof(*c));
+	if(!c)
+		return NULL;
+	c->nbuckets = 1;
+	while(c->nbuckets < length)
+		c->nbuckets <<= 1;
+	if(!(c->buckets = calloc(c->nbuckets, sizeof(*c->buckets))) || pthread_mutex_init(&c->lock, NULL)) {
+		free(c->buckets);
+		free(c);
+		return NULL;
+	}
+	c->lru.next = c->lru.prev = &c->lru;
+	c->capacity = length;
+	c->max_bytes = max_bytes;
+	return c;
+}
+
+void hfs_dir_cache_destroy(struct hfs_dir_cache* c) {
+	if(!c)
+		return;
+	for(struct dir_entry* e = c->lru.next,* next; e != &c->lru; e = next) {
+		next = e->next;
+		hfs_free_directory_listing(&e->listing);
+		free(e);
+	}
+	pthread_mutex_destroy(&c->lock);
+	free(c->buckets);
+	free(c);
+}
+
+static inline struct dir_entry** dir_bucket(struct hfs_dir_cache* c, hfs_cnid_t cnid) {
+	return c->buckets + ((cnid * UINT32_C(2654435761)) & (c->nbuckets - 1));
+}
+
+static inline struct dir_entry* dir_find(struct hfs_dir_cache* c, hfs_cnid_t cnid) {
+	struct dir_entry* e = *dir_bucket(c, cnid);
+	while(e && e->cnid != cnid)
+		e = e->hnext;
+	return e;
+}
+
+static inline void dir_unlink(struct dir_entry* e) {
+	e->prev->next = e->next;
+	e->next->prev = e->prev;
+}
+
+static inline void dir_push(struct hfs_dir_cache* c, struct dir_entry* e) {
+	e->next = c->lru.next;
+	e->prev = &c->lru;
+	c->lru.next->prev = e;
+	c->lru.next = e;
+}
+
+// evicts unused listings, least recently used first, until one more of the given size fits
+static bool dir_make_room(struct hfs_dir_cache* c, size_t bytes) {
+	for(struct dir_entry* e = c->lru.prev,* prev; e != &c->lru && (c->count >= c->capacity || c->bytes + bytes > c->max_bytes); e = prev) {
+		prev = e->prev;
+		if(e->refs)
+			continue;
+		struct dir_entry** it = dir_bucket(c, e->cnid);
+		while(*it != e)
+			it = &(*it)->hnext;
+		*it = e->hnext;
+		dir_unlink(e);
+		c->count--;
+		c->bytes -= e->bytes;
+		c->evictions++;
+		hfs_free_directory_listing(&e->listing);
+		free(e);
+	}
+	return c->count < c->capacity && c->bytes + bytes <= c->max_bytes;
+}
+
+const struct hfs_dir_listing* hfs_dir_cache_lookup(struct hfs_dir_cache* c, hfs_cnid_t cnid) {
+	if(!c || pthread_mutex_lock(&c->lock))
+		return NULL;
+	struct dir_entry* e = dir_find(c, cnid);
+	if(e) {
+		e->refs++;
+		dir_unlink(e);
+		dir_push(c, e);
+		c->hits++;
+	}
+	else c->misses++;
+	pthread_mutex_unlock(&c->lock);
+	return e ? &e->listing : NULL;
+}
+
+void hfs_dir_cache_add(struct hfs_dir_cache* c, hfs_cnid_t cnid, struct hfs_dir_listing* listing) {
+	size_t bytes = dir_listing_bytes(listing);
+	struct dir_entry* e = NULL;
+	if(!c || bytes > c->max_bytes || pthread_mutex_lock(&c->lock))
+		goto fail;
+	// another reader of this folder got there first, or everything is in use
+	if(dir_find(c, cnid) || !dir_make_room(c, bytes) || !(e = malloc(sizeof(*e)))) {
+		pthread_mutex_unlock(&c->lock);
+		goto fail;
+	}
+
+	e->listing = *listing;
+	e->cnid = cnid;
+	e->refs = 0;
+	e->bytes = bytes;
+	struct dir_entry** bucket = dir_bucket(c, cnid);
+	e->hnext = *bucket;
+	*bucket = e;
+	dir_push(c, e);
+	c->count++;
+	c->bytes += bytes;
+	pthread_mutex_unlock(&c->lock);
+	*listing = (struct hfs_dir_listing){0};
+	return;
+
+fail:
+	hfs_free_directory_listing(listing);
+}
+
+void hfs_dir_cache_release(struct hfs_dir_cache* c, const struct hfs_dir_listing* listing) {
+	if(!c || !listing || pthread_mutex_lock(&c->lock))
+		return;
+	((struct dir_entry*)listing)->refs--;
+	pthread_mutex_unlock(&c->lock);
+}
+
+void hfs_dir_cache_stats(struct hfs_dir_cache* c, struct hfs_dir_cache_stats* stats) {
+	*stats = (struct hfs_dir_cache_stats){0};
+	if(!c || pthread_mutex_lock(&c->lock))
+		return;
+	stats->hits = c->hits;
+	stats->misses = c->misses;
+	stats->evictions = c->evictions;
+	stats->listings = c->count;
+	stats->capacity = c->capacity;
+	stats->bytes = c->bytes;
+	stats->max_bytes = c->max_bytes;
+	pthread_mutex_unlock(&c->lock);
 }
@@ -18,5 +18,55 @@ void hfs_record_cache_destroy(struct hfs_record_cache*);
 bool hfs_record_cache_lookup(struct hfs_record_cache*, const char* path, size_t len, hfs_catalog_keyed_record_t* record);
 size_t hfs_record_cache_lookup_parents(struct hfs_record_cache*, char* path, size_t len, hfs_catalog_keyed_record_t* record);
 void hfs_record_cache_add(struct hfs_record_cache*, const char* path, size_t len, hfs_catalog_keyed_record_t* record);
+void hfs_record_cache_stats(struct hfs_record_cache*, struct hfs_record_cache_stats*);
+
+// record caches keyed by a single path component: the parent folder's cnid and the name within it
+// names should be normalized by the caller, e.g. case folded on case insensitive volumes
+struct hfs_record_cache* hfs_dentry_cache_create(size_t length);
+bool hfs_dentry_cache_lookup(struct hfs_record_cache*, hfs_cnid_t parent, const hfs_unistr255_t* name, hfs_catalog_keyed_record_t* record);
+void hfs_dentry_cache_add(struct hfs_record_cache*, hfs_cnid_t parent, const hfs_unistr255_t* name, hfs_catalog_keyed_record_t* record);
+
+// only remembers which names are absent from a folder
+struct hfs_record_cache* hfs_negative_cache_create(size_t length);
+bool hfs_negative_cache_lookup(struct hfs_record_cache*, hfs_cnid_t parent, const hfs_unistr255_t* name);
+void hfs_negative_cache_add(struct hfs_record_cache*, hfs_cnid_t parent, const hfs_unistr255_t* name);
+
+// what hfs_decmpfs_lookup found for a file, keyed by its cnid
+// the attribute itself is only kept if it's small, e.g. a header for data in the resource fork or a tiny inline compressed file
+#define HFS_DECMPFS_CACHE_DATA 64
+struct hfs_decmpfs_cache_value {
+	struct hfs_decmpfs_header header;
+	int32_t status; // 0 if compressed, 1 if not, or negative errno
+	uint32_t length; // of the attribute, which is in data if it fits
+	unsigned char data[HFS_DECMPFS_CACHE_DATA];
+};
+
+struct hfs_record_cache* hfs_decmpfs_cache_create(size_t length);
+bool hfs_decmpfs_cache_lookup(struct hfs_record_cache*, hfs_cnid_t cnid, struct hfs_decmpfs_cache_value*);
+void hfs_decmpfs_cache_add(struct hfs_record_cache*, hfs_cnid_t cnid, const struct hfs_decmpfs_cache_value*);
+// the decmpfs cache of a volume opened with hfs_open_volume, NULL if disabled
+struct hfs_record_cache* hfs_volume_decmpfs_cache(hfs_volume*);
+
+struct hfs_node_cache;
+
+struct hfs_node_cache* hfs_node_cache_create(size_t length);
+void hfs_node_cache_destroy(struct hfs_node_cache*);
+// returns a referenced node buffer, or NULL if not present
+void* hfs_node_cache_lookup(struct hfs_node_cache*, uint8_t file, uint32_t node);
+// takes ownership of data and returns the referenced buffer to use in its place
+void* hfs_node_cache_add(struct hfs_node_cache*, uint8_t file, uint32_t node, void* data);
+void hfs_node_cache_release(struct hfs_node_cache*, uint8_t file, uint32_t node, void* data);
+void hfs_node_cache_stats(struct hfs_node_cache*, struct hfs_node_cache_stats*);
+
+struct hfs_dir_cache;
+
+struct hfs_dir_cache* hfs_dir_cache_create(size_t length, size_t max_bytes);
+void hfs_dir_cache_destroy(struct hfs_dir_cache*);
+// returns a referenced listing, or NULL if not present
+const struct hfs_dir_listing* hfs_dir_cache_lookup(struct hfs_dir_cache*, hfs_cnid_t cnid);
+// takes ownership of the listing's buffers, which are freed if it can't be cached
+void hfs_dir_cache_add(struct hfs_dir_cache*, hfs_cnid_t cnid, struct hfs_dir_listing*);
+void hfs_dir_cache_release(struct hfs_dir_cache*, const struct hfs_dir_listing*);
+void hfs_dir_cache_stats(struct hfs_dir_cache*, struct hfs_dir_cache_stats*);
 
 #endif
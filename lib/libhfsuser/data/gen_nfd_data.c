@@ -0,0 +1,146 @@
+/*
+ * libhfsuser - Userspace support library for NetBSD's libhfs
+ * This file is part of the hfsfuse project.
+ *
+ * Generates nfd_data.h, the decomposition and combining class tables used by hfs_pathname_from_unix.
+ * Only the codepoints HFS+ actually decomposes are covered: the BMP minus U+2000-U+2FFF and U+F900-U+FAFF.
+ * Hangul syllables are left out as they decompose algorithmically.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "utf8proc.h"
+
+#define HFSINRANGE(codepoint) ( \
+	((codepoint) >= 0x0000 && (codepoint) <= 0xFFFF) &&  \
+	!(((codepoint) >= 0x2000 && (codepoint) <= 0x2FFF) ||\
+	  ((codepoint) >= 0xF900 && (codepoint) <= 0xFAFF))  \
+)
+
+#define HANGUL_SBASE 0xAC00
+#define HANGUL_SCOUNT 11172
+
+#define BLOCK_SHIFT 6
+#define BLOCK_SIZE (1 << BLOCK_SHIFT)
+#define NBLOCKS (0x10000 >> BLOCK_SHIFT)
+
+#define die(...) do { fprintf(stderr, __VA_ARGS__); exit(1); } while(0)
+
+static uint8_t ccc[0x10000];
+static uint16_t decomp[0x10000];
+
+// sequences are stored as a length followed by the UTF-16 units, index 0 is reserved for "no decomposition"
+static uint16_t seq[0x10000];
+static size_t seqlen = 1;
+
+static uint8_t combining_class(utf8proc_int32_t cp) {
+	return HFSINRANGE(cp) ? utf8proc_get_property(cp)->combining_class : 0;
+}
+
+static uint16_t add_sequence(const utf8proc_int32_t* buf, utf8proc_ssize_t len) {
+	for(size_t i = 1; i < seqlen; i += seq[i] + 1) {
+		if(seq[i] != len)
+			continue;
+		utf8proc_ssize_t j = 0;
+		while(j < len && seq[i+1+j] == buf[j])
+			j++;
+		if(j == len)
+			return i;
+	}
+	if(seqlen + len + 1 > 0xFFFF)
+		die("decomposition sequences overflow a uint16_t index\n");
+	size_t ret = seqlen;
+	seq[seqlen++] = len;
+	for(utf8proc_ssize_t j = 0; j < len; j++)
+		seq[seqlen++] = buf[j];
+	return ret;
+}
+
+// splits a 64k table into deduplicated blocks and an index into them
+static size_t split_blocks(const void* table, size_t width, uint8_t* index, unsigned char* blocks) {
+	size_t nblocks = 0, bsize = BLOCK_SIZE * width;
+	for(size_t b = 0; b < NBLOCKS; b++) {
+		const unsigned char* block = (const unsigned char*)table + b * bsize;
+		size_t i;
+		for(i = 0; i < nblocks && memcmp(blocks + i * bsize, block, bsize); i++);
+		if(i == nblocks) {
+			if(nblocks == 256)
+				die("too many distinct blocks for a uint8_t index\n");
+			memcpy(blocks + nblocks++ * bsize, block, bsize);
+		}
+		index[b] = i;
+	}
+	return nblocks;
+}
+
+static void print_index(const char* name, const uint8_t* index) {
+	printf("static const uint8_t %s[%d] = {", name, NBLOCKS);
+	for(size_t i = 0; i < NBLOCKS; i++)
+		printf("%s%u,", i % 32 ? " " : "\n\t", index[i]);
+	printf("\n};\n\n");
+}
+
+int main(void) {
+	for(utf8proc_int32_t cp = 0; cp < 0x10000; cp++) {
+		if(!HFSINRANGE(cp))
+			continue;
+		ccc[cp] = combining_class(cp);
+		if(cp >= HANGUL_SBASE && cp < HANGUL_SBASE + HANGUL_SCOUNT)
+			continue;
+
+		utf8proc_int32_t buf[16];
+		utf8proc_ssize_t len = utf8proc_decompose_char(cp, buf, 16, UTF8PROC_DECOMPOSE, NULL);
+		if(len <= 0 || len > 16)
+			die("failed to decompose U+%04X\n", cp);
+		if(len == 1 && buf[0] == cp)
+			continue;
+		for(utf8proc_ssize_t i = 0; i < len; i++)
+			if(buf[i] > 0xFFFF)
+				die("U+%04X decomposes outside the BMP\n", cp);
+		// hfs_NFD only checks the ordering of combining characters where sequences meet
+		for(utf8proc_ssize_t i = 1; i < len; i++)
+			if(combining_class(buf[i]) && combining_class(buf[i-1]) > combining_class(buf[i]))
+				die("decomposition of U+%04X is not in canonical order\n", cp);
+		decomp[cp] = add_sequence(buf, len);
+	}
+
+	static uint8_t ccc_index[NBLOCKS], decomp_index[NBLOCKS];
+	static uint8_t ccc_blocks[NBLOCKS][BLOCK_SIZE];
+	static uint16_t decomp_blocks[NBLOCKS][BLOCK_SIZE];
+	size_t nccc = split_blocks(ccc, sizeof(*ccc), ccc_index, (unsigned char*)ccc_blocks);
+	size_t ndecomp = split_blocks(decomp, sizeof(*decomp), decomp_index, (unsigned char*)decomp_blocks);
+
+	printf("// Generated by data/gen_nfd_data.c from utf8proc %s (Unicode %s), do not edit.\n", utf8proc_version(), utf8proc_unicode_version());
+	printf("// Codepoints are looked up in %d-entry blocks: table[index[cp >> %d]][cp & %d].\n\n", BLOCK_SIZE, BLOCK_SHIFT, BLOCK_SIZE - 1);
+	printf("#define HFS_NFD_BLOCK_SHIFT %d\n\n", BLOCK_SHIFT);
+
+	print_index("hfs_ccc_index", ccc_index);
+	printf("static const uint8_t hfs_ccc_blocks[%zu][%d] = {\n", nccc, BLOCK_SIZE);
+	for(size_t b = 0; b < nccc; b++) {
+		printf("\t{");
+		for(size_t i = 0; i < BLOCK_SIZE; i++)
+			printf("%s%u,", i % 32 ? " " : "\n\t\t", ccc_blocks[b][i]);
+		printf("\n\t},\n");
+	}
+	printf("};\n\n");
+
+	print_index("hfs_decomp_index", decomp_index);
+	printf("static const uint16_t hfs_decomp_blocks[%zu][%d] = {\n", ndecomp, BLOCK_SIZE);
+	for(size_t b = 0; b < ndecomp; b++) {
+		printf("\t{");
+		for(size_t i = 0; i < BLOCK_SIZE; i++)
+			printf("%s%u,", i % 16 ? " " : "\n\t\t", decomp_blocks[b][i]);
+		printf("\n\t},\n");
+	}
+	printf("};\n\n");
+
+	printf("// each sequence is a length followed by that many UTF-16 units\n");
+	printf("static const uint16_t hfs_decomp_seq[%zu] = {", seqlen);
+	for(size_t i = 0; i < seqlen; i++)
+		printf("%s0x%04X,", i % 12 ? " " : "\n\t", seq[i]);
+	printf("\n};\n");
+	return 0;
+}
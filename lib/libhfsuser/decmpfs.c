@@ -6,6 +6,7 @@
 #include "byteorder.h"
 #include "features.h"
 #include "hfsuser.h"
+#include "cache.h"
 
 #include <inttypes.h>
 #include <errno.h>
@@ -40,6 +41,7 @@ struct hfs_decmpfs_context {
 	size_t current_chunk_len;
 	pthread_rwlock_t current_chunk_lock;
 	hfs_extent_descriptor_t* extents;
+	uint64_t* extent_offsets;
 	uint16_t nextents;
 };
 
@@ -116,7 +118,7 @@ int hfs_decmpfs_decompress(uint8_t type, unsigned char* decompressed_buf, size_t
 	return 1;
 }
 
-struct hfs_decmpfs_context* hfs_decmpfs_create_context(hfs_volume* vol, hfs_cnid_t cnid, uint32_t length, unsigned char* data, int* out_err) {
+struct hfs_decmpfs_context* hfs_decmpfs_create_context(hfs_volume* vol, hfs_file_record_t* file, uint32_t length, unsigned char* data, int* out_err) {
 	int err = 0;
 	struct hfs_decmpfs_context* ctx = NULL;
 
@@ -152,6 +154,7 @@ struct hfs_decmpfs_context* hfs_decmpfs_create_context(hfs_volume* vol, hfs_cnid
 	ctx->current_chunk = 0;
 	ctx->current_chunk_len = 0;
 	ctx->extents = NULL;
+	ctx->extent_offsets = NULL;
 	ctx->nextents = 0;
 
 	if(pthread_rwlock_init(&ctx->current_chunk_lock,NULL)) {
@@ -180,10 +183,11 @@ struct hfs_decmpfs_context* hfs_decmpfs_create_context(hfs_volume* vol, hfs_cnid
 	}
 	else {
 		// resource fork
-		if(!(ctx->nextents = hfslib_get_file_extents(vol,cnid,HFS_RSRCFORK,&ctx->extents,NULL))) {
+		if(!(ctx->nextents = hfslib_get_fork_extents(vol,file->cnid,HFS_RSRCFORK,&file->rsrc_fork,&ctx->extents,NULL))) {
 			err = -1;
 			goto err;
 		}
+		hfslib_get_extent_offsets(vol,ctx->extents,ctx->nextents,&ctx->extent_offsets,NULL);
 		if(compression_type == DECMPFS_COMPRESSION_ZLIB) {
 			uint64_t bytes;
 			uint32_t rsrc_start; // usually 256
@@ -195,7 +199,7 @@ struct hfs_decmpfs_context* hfs_decmpfs_create_context(hfs_volume* vol, hfs_cnid
 			}
 			rsrc_start = be32toh(rsrc_start);
 
-			if((err = hfslib_readd_with_extents(vol,&ctx->nchunks,&bytes,4,rsrc_start+4,ctx->extents,ctx->nextents,NULL)))
+			if((err = hfslib_readd_with_extent_offsets(vol,&ctx->nchunks,&bytes,4,rsrc_start+4,ctx->extents,ctx->extent_offsets,ctx->nextents,NULL)))
 				goto err;
 			if(bytes < 4) {
 				err = -EIO;
@@ -205,7 +209,7 @@ struct hfs_decmpfs_context* hfs_decmpfs_create_context(hfs_volume* vol, hfs_cnid
 				err = -ENOMEM;
 				goto err;
 			}
-			if((err = hfslib_readd_with_extents(vol,ctx->chunk_map,&bytes,ctx->nchunks*sizeof(*ctx->chunk_map),rsrc_start+8,ctx->extents,ctx->nextents,NULL)))
+			if((err = hfslib_readd_with_extent_offsets(vol,ctx->chunk_map,&bytes,ctx->nchunks*sizeof(*ctx->chunk_map),rsrc_start+8,ctx->extents,ctx->extent_offsets,ctx->nextents,NULL)))
 				goto err;
 			if(bytes < ctx->nchunks*sizeof(*ctx->chunk_map)) {
 				err = -EIO;
@@ -263,6 +267,7 @@ void hfs_decmpfs_destroy_context(struct hfs_decmpfs_context* ctx) {
 		return;
 	pthread_rwlock_destroy(&ctx->current_chunk_lock);
 	free(ctx->extents);
+	free(ctx->extent_offsets);
 	free(ctx->chunk_map);
 	free(ctx->buf);
 	free(ctx);
@@ -317,7 +322,7 @@ static int decmpfs_read_rsrc(hfs_volume* vol, struct hfs_decmpfs_context* ctx, c
 			}
 
 			uint64_t compressed_bytes_read;
-			hfslib_readd_with_extents(vol,compressed_buf,&compressed_bytes_read,chunk_len,chunk_offset,ctx->extents,ctx->nextents,NULL);
+			hfslib_readd_with_extent_offsets(vol,compressed_buf,&compressed_bytes_read,chunk_len,chunk_offset,ctx->extents,ctx->extent_offsets,ctx->nextents,NULL);
 			if((ret = hfs_decmpfs_decompress(ctx->header.type, ctx->buf, ctx->buflen, compressed_buf, compressed_bytes_read, &bytes_read, NULL)))
 				break;
 			ctx->current_chunk = i;
@@ -372,6 +377,31 @@ size_t hfs_decmpfs_buffer_size(struct hfs_decmpfs_header* h) {
 	return decmpfs_storage_inline(h->type) ? h->logical_size : min(h->logical_size,CHUNK_SIZE);
 }
 
+// checks that attr holds a supported decmpfs header and parses it into h
+static int hfs_decmpfs_check_attribute(hfs_cnid_t cnid, hfs_attribute_record_t* attr, unsigned char* buf, struct hfs_decmpfs_header* h) {
+	// if this is a zlib, lzvn, or lzfse compressed file and hfsfuse wasn't built with these libraries, continue to treat it as a zero-length file
+	// the com.apple.decmpfs xattr may still be inspected directly to access the compressed data
+	if(attr->type != HFS_ATTR_INLINE_DATA || !hfs_decmpfs_parse_record(h,attr->inline_record.length,buf))
+		return -EINVAL;
+	if(!hfs_decmpfs_compression_supported(h->type)) {
+		hfslib_error("unsupported decmpfs type %" PRIu8 " for cnid %" PRIu32 "\n",NULL,0,h->type,cnid);
+		return -ENOTSUP;
+	}
+	return 0;
+}
+
+static void hfs_decmpfs_cache_result(hfs_volume* vol, hfs_cnid_t cnid, int status, const struct hfs_decmpfs_header* h, uint32_t length, const unsigned char* data) {
+	struct hfs_record_cache* cache = hfs_volume_decmpfs_cache(vol);
+	if(!cache)
+		return;
+	struct hfs_decmpfs_cache_value v = { .status = status, .length = length };
+	if(!status)
+		v.header = *h;
+	if(data && length <= HFS_DECMPFS_CACHE_DATA)
+		memcpy(v.data,data,length);
+	hfs_decmpfs_cache_add(cache,cnid,&v);
+}
+
 int hfs_decmpfs_lookup(hfs_volume* vol, hfs_file_record_t* file, struct hfs_decmpfs_header* h, uint32_t* length, unsigned char** data) {
 	if(data)
 		*data = NULL;
@@ -381,23 +411,38 @@ int hfs_decmpfs_lookup(hfs_volume* vol, hfs_file_record_t* file, struct hfs_decm
 	if(!(file->bsd.owner_flags & HFS_UF_COMPRESSED) || file->data_fork.logical_size)
 		return 1;
 
+	struct hfs_decmpfs_cache_value cached;
+	if(hfs_decmpfs_cache_lookup(hfs_volume_decmpfs_cache(vol),file->cnid,&cached)) {
+		if(cached.status)
+			return cached.status;
+		// an attribute too large to have been cached is read again below
+		if(!data || cached.length <= HFS_DECMPFS_CACHE_DATA) {
+			if(data) {
+				if(!(*data = malloc(cached.length)))
+					return -ENOMEM;
+				memcpy(*data,cached.data,cached.length);
+			}
+			if(length)
+				*length = cached.length;
+			*h = cached.header;
+			return 0;
+		}
+	}
+
 	hfs_attribute_key_t attrkey;
 	hfslib_make_attribute_key(file->cnid,0,strlen("com.apple.decmpfs"),u"com.apple.decmpfs",&attrkey);
 	hfs_attribute_record_t attr;
 	unsigned char* buf = NULL;
-	if(hfslib_find_attribute_record_with_key(vol,&attrkey,&attr,(void*)&buf,NULL))
+	if(hfslib_find_attribute_record_with_key(vol,&attrkey,&attr,(void*)&buf,NULL)) {
+		hfs_decmpfs_cache_result(vol,file->cnid,1,NULL,0,NULL);
 		return 1;
-
-	// if this is a zlib, lzvn, or lzfse compressed file and hfsfuse wasn't built with these libraries, continue to treat it as a zero-length file
-	// the com.apple.decmpfs xattr may still be inspected directly to access the compressed data
-	if(attr.type != HFS_ATTR_INLINE_DATA || !hfs_decmpfs_parse_record(h,attr.inline_record.length,buf)) {
-		free(buf);
-		return -EINVAL;
 	}
-	if(!hfs_decmpfs_compression_supported(h->type)) {
+
+	int ret = hfs_decmpfs_check_attribute(file->cnid,&attr,buf,h);
+	hfs_decmpfs_cache_result(vol,file->cnid,ret,h,attr.inline_record.length,buf);
+	if(ret) {
 		free(buf);
-		hfslib_error("unsupported decmpfs type %" PRIu8 " for cnid %" PRIu32 "\n",NULL,0,h->type,file->cnid);
-		return -ENOTSUP;
+		return ret;
 	}
 
 	if(length)
@@ -409,3 +454,70 @@ int hfs_decmpfs_lookup(hfs_volume* vol, hfs_file_record_t* file, struct hfs_decm
 
 	return 0;
 }
+
+static int compare_cnid_index(const void* a, const void* b) {
+	uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+	return (x > y) - (x < y);
+}
+
+int hfs_decmpfs_lookup_batch(hfs_volume* vol, struct hfs_dirent* entries, uint32_t count) {
+	// the same checks as hfs_decmpfs_lookup
+	uint32_t n = 0;
+	for(uint32_t i = 0; i < count; i++) {
+		struct hfs_dirent* ent = entries + i;
+		if(ent->type != HFS_REC_FILE || !(ent->owner_flags & HFS_UF_COMPRESSED) || ent->decmpfs)
+			continue;
+		if(ent->logical_size)
+			ent->decmpfs = HFS_DIRENT_UNCOMPRESSED;
+		else n++;
+	}
+	if(!n)
+		return 0;
+
+	// attribute keys sort by CNID first, so looking them up in CNID order moves forward through the leaves
+	uint64_t* order = malloc(n * sizeof(*order));
+	if(!order)
+		return -ENOMEM;
+	n = 0;
+	for(uint32_t i = 0; i < count; i++)
+		if(entries[i].type == HFS_REC_FILE && !entries[i].decmpfs && (entries[i].owner_flags & HFS_UF_COMPRESSED))
+			order[n++] = ((uint64_t)entries[i].cnid << 32) | i;
+	qsort(order,n,sizeof(*order),compare_cnid_index);
+
+	struct hfs_record_cache* cache = hfs_volume_decmpfs_cache(vol);
+	hfs_attribute_cursor_t cursor = {0};
+	for(uint32_t k = 0; k < n; k++) {
+		struct hfs_dirent* ent = entries + (uint32_t)order[k];
+		ent->decmpfs = HFS_DIRENT_UNCOMPRESSED;
+
+		struct hfs_decmpfs_cache_value cached;
+		if(hfs_decmpfs_cache_lookup(cache,ent->cnid,&cached)) {
+			if(!cached.status) {
+				ent->decmpfs = cached.header.type;
+				ent->logical_size = cached.header.logical_size;
+			}
+			continue;
+		}
+
+		hfs_attribute_key_t attrkey;
+		hfslib_make_attribute_key(ent->cnid,0,strlen("com.apple.decmpfs"),u"com.apple.decmpfs",&attrkey);
+		hfs_attribute_record_t attr;
+		unsigned char* buf = NULL;
+		if(hfslib_find_attribute_record_near(vol,&cursor,&attrkey,&attr,(void*)&buf,NULL)) {
+			hfs_decmpfs_cache_result(vol,ent->cnid,1,NULL,0,NULL);
+			continue;
+		}
+
+		struct hfs_decmpfs_header h;
+		int ret = hfs_decmpfs_check_attribute(ent->cnid,&attr,buf,&h);
+		if(!ret) {
+			ent->decmpfs = h.type;
+			ent->logical_size = h.logical_size;
+		}
+		hfs_decmpfs_cache_result(vol,ent->cnid,ret,&h,attr.inline_record.length,buf);
+		free(buf);
+	}
+	hfslib_close_attribute_cursor(vol,&cursor,NULL);
+	free(order);
+	return 0;
+}
@@ -13,9 +13,6 @@ enum hfs_lib_features hfs_get_lib_features(void) {
 #ifdef HAVE_UBLIO
 	     | HFS_LIB_FEATURES_UBLIO
 #endif
-#ifdef HAVE_UTF8PROC
-	     | HFS_LIB_FEATURES_UTF8PROC
-#endif
 #ifdef HAVE_ZLIB
 	     | HFS_LIB_FEATURES_ZLIB
 #endif
@@ -24,6 +21,9 @@ enum hfs_lib_features hfs_get_lib_features(void) {
 #endif
 #ifdef HAVE_LZVN
 	     | HFS_LIB_FEATURES_LZVN
+#endif
+#if HAVE_IO_URING
+	     | HFS_LIB_FEATURES_IO_URING
 #endif
 	;
 }
@@ -41,11 +41,7 @@ const char* hfs_lib_ublio_version(void) {
 }
 
 const char* hfs_lib_utf8proc_version(void) {
-#ifdef HAVE_UTF8PROC
-	return utf8proc_version();
-#else
 	return NULL;
-#endif
 }
 
 const char* hfs_lib_zlib_version(void) {
@@ -6,10 +6,6 @@
 #ifndef HFSUSER_FEATURES_H
 #define HFSUSER_FEATURES_H
 
-#ifdef HAVE_UTF8PROC
-#include "utf8proc.h"
-#endif
-
 #ifdef HAVE_UBLIO
 #include <stdint.h>
 #include <sys/types.h>
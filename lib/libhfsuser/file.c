@@ -13,6 +13,7 @@ struct hfs_file {
 	hfs_volume* vol;
 	hfs_catalog_keyed_record_t rec;
 	hfs_extent_descriptor_t* extents;
+	uint64_t* extent_offsets;
 	uint16_t nextents;
 	uint8_t fork;
 	uint64_t logical_size;
@@ -39,6 +40,7 @@ struct hfs_file* hfs_file_open(hfs_volume* vol, hfs_catalog_keyed_record_t* rec,
 	f->rec = *rec;
 	f->fork = fork;
 	f->extents = NULL;
+	f->extent_offsets = NULL;
 	f->nextents = 0;
 	f->logical_size = (fork == HFS_RSRCFORK ? rec->file.rsrc_fork : rec->file.data_fork).logical_size;
 	f->decmpfs = NULL;
@@ -54,7 +56,7 @@ struct hfs_file* hfs_file_open(hfs_volume* vol, hfs_catalog_keyed_record_t* rec,
 	unsigned char* inlinedata;
 	if(fork == HFS_DATAFORK && !hfs_decmpfs_lookup(vol,&rec->file,&h,&inlinelength,&inlinedata)) {
 		f->logical_size = h.logical_size;
-		f->decmpfs = hfs_decmpfs_create_context(vol,rec->file.cnid,inlinelength,inlinedata,&err);
+		f->decmpfs = hfs_decmpfs_create_context(vol,&rec->file,inlinelength,inlinedata,&err);
 		free(inlinedata);
 		if(!f->decmpfs) {
 			pthread_mutex_destroy(&f->read_mutex);
@@ -62,7 +64,12 @@ struct hfs_file* hfs_file_open(hfs_volume* vol, hfs_catalog_keyed_record_t* rec,
 			goto error;
 		}
 	}
-	else f->nextents = hfslib_get_file_extents(vol,rec->file.cnid,fork,&f->extents,NULL);
+	else {
+		f->nextents = hfslib_get_fork_extents(vol,rec->file.cnid,fork,fork == HFS_RSRCFORK ? &rec->file.rsrc_fork : &rec->file.data_fork,&f->extents,NULL);
+		// without the table reads still work, they just scan the extents from the start
+		if(f->nextents)
+			hfslib_get_extent_offsets(vol,f->extents,f->nextents,&f->extent_offsets,NULL);
+	}
 
 	if(out_err)
 		*out_err = 0;
@@ -92,6 +99,7 @@ void hfs_file_close(struct hfs_file* f) {
 	hfs_decmpfs_destroy_context(f->decmpfs);
 	pthread_mutex_destroy(&f->read_mutex);
 	free(f->extents);
+	free(f->extent_offsets);
 	free(f);
 }
 
@@ -105,7 +113,7 @@ ssize_t hfs_file_pread(struct hfs_file* f, void* restrict buf, size_t size, off_
 		size = f->logical_size - offset;
 	if(f->decmpfs)
 		return hfs_decmpfs_read(f->vol,f->decmpfs,buf,size,offset);
-	int ret = hfslib_readd_with_extents(f->vol,buf,&bytes,size,offset,f->extents,f->nextents,NULL);
+	int ret = hfslib_readd_with_extent_offsets(f->vol,buf,&bytes,size,offset,f->extents,f->extent_offsets,f->nextents,NULL);
 	if(ret < 0)
 		return ret;
 	if(bytes > SSIZE_MAX)
@@ -6,6 +6,7 @@
 #include "hfsuser.h"
 #include "cache.h"
 #include "features.h"
+#include "uring.h"
 
 #include <stdbool.h>
 #include <errno.h>
@@ -16,9 +17,16 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <inttypes.h>
+#if HAVE_PREADV
+#include <sys/uio.h>
+#endif
 
 #include "unicode.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #ifdef __MINGW32__
 // mignw doesn't provide these types but defines the corresponding fields in struct stat as follows
 typedef short uid_t;
@@ -52,6 +60,11 @@ struct hfs_device {
 	int fd;
 	uint32_t blksize;
 	struct hfs_record_cache* cache;
+	struct hfs_record_cache* dentry_cache;
+	struct hfs_record_cache* negative_cache;
+	struct hfs_node_cache* node_cache;
+	struct hfs_dir_cache* dir_cache;
+	struct hfs_record_cache* decmpfs_cache;
 	char* rsrc_suff;
 	size_t rsrc_len;
 	uint8_t default_fork;
@@ -61,6 +74,7 @@ struct hfs_device {
 	void* read_buf;
 	pthread_mutex_t read_mutex;
 	bool disable_symlinks;
+	bool use_io_uring;
 #ifdef HAVE_UBLIO
 	bool use_ublio;
 	ublio_filehandle_t ubfh;
@@ -71,6 +85,12 @@ struct hfs_device {
 void hfs_volume_config_defaults(struct hfs_volume_config* cfg) {
 	*cfg = (struct hfs_volume_config) {
 		.cache_size = 1024,
+		.dentry_cache_size = 4096,
+		.negative_cache_size = 1024,
+		.node_cache_size = 512,
+		.dir_cache_size = 64,
+		.dir_cache_max_bytes = 8 << 20,
+		.decmpfs_cache_size = 1024,
 		.ublio_items = 64,
 		.ublio_grace = 32,
 		.default_file_mode = 0755,
@@ -78,57 +98,210 @@ void hfs_volume_config_defaults(struct hfs_volume_config* cfg) {
 	};
 }
 
-ssize_t hfs_unistr_to_utf8(const hfs_unistr255_t* u16, char* u8) {
+// these follow libhfs's utf16_to_utf8/utf8_to_utf16, counting and skipping anything invalid, but convert runs of ASCII 16 units at a time
+// '/' and ':' are swapped in the same pass when converting pathnames
+
+// u8 must have room for 3 bytes per unit of u16
+static size_t hfs_utf16_to_utf8(char* restrict u8, const uint16_t* restrict u16, size_t len, bool pathname, int* err) {
+	size_t i = 0, pos = 0;
+	*err = 0;
+	while(i < len) {
+#ifdef __SSE2__
+		const __m128i high = _mm_set1_epi16(~0x7F), zero = _mm_setzero_si128(), slash = _mm_set1_epi8('/'), colon = _mm_set1_epi8(':');
+		for(; i + 16 <= len; i += 16, pos += 16) {
+			__m128i lo = _mm_loadu_si128((const __m128i*)(u16 + i)), hi = _mm_loadu_si128((const __m128i*)(u16 + i + 8));
+			if(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(lo, hi), high), zero)) != 0xFFFF)
+				break;
+			__m128i v = _mm_packus_epi16(lo, hi);
+			if(pathname) {
+				__m128i is_slash = _mm_cmpeq_epi8(v, slash);
+				v = _mm_or_si128(_mm_andnot_si128(is_slash, v), _mm_and_si128(is_slash, colon));
+			}
+			_mm_storeu_si128((__m128i*)(u8 + pos), v);
+		}
+		// finish the block that stopped the vector loop one unit at a time
+		for(size_t end = i + 16 < len ? i + 16 : len; i < end; i++) {
+#else
+		for(; i < len; i++) {
+#endif
+			uint16_t c = u16[i];
+			if(c < 0x80)
+				u8[pos++] = pathname && c == '/' ? ':' : c;
+			else if(c < 0x800) {
+				u8[pos++] = 0xC0 | (c >> 6);
+				u8[pos++] = 0x80 | (c & 0x3F);
+			}
+			else if(c >= 0xD800 && c < 0xE000) {
+				// only a high surrogate followed by a low one is valid
+				if(c >= 0xDC00 || i == len - 1 || (u16[i+1] & 0xFC00) != 0xDC00) {
+					++*err;
+					continue;
+				}
+				uint32_t cp = (((c & 0x3FF) << 10) | (u16[++i] & 0x3FF)) + 0x10000;
+				u8[pos++] = 0xF0 | (cp >> 18);
+				u8[pos++] = 0x80 | ((cp >> 12) & 0x3F);
+				u8[pos++] = 0x80 | ((cp >> 6) & 0x3F);
+				u8[pos++] = 0x80 | (cp & 0x3F);
+			}
+			else {
+				u8[pos++] = 0xE0 | (c >> 12);
+				u8[pos++] = 0x80 | ((c >> 6) & 0x3F);
+				u8[pos++] = 0x80 | (c & 0x3F);
+			}
+		}
+	}
+	return pos;
+}
+
+// u8 must be nul terminated, and len is the number of units u16 has room for
+// returns the number of units the whole conversion needs, which may be more than len
+static size_t hfs_utf8_to_utf16(uint16_t* restrict u16, size_t len, const char* restrict u8, int* err) {
+	const unsigned char* s = (const unsigned char*)u8;
+	size_t pos = 0;
+	*err = 0;
+	const unsigned char* end = s + strlen(u8), *stop = end;
+#define IS_CONT(c) (((c) & 0xC0) == 0x80)
+#define PUT(c) do { if(pos < len) u16[pos] = (c); pos++; } while(0)
+	while(s < end) {
+#ifdef __SSE2__
+		const __m128i zero = _mm_setzero_si128();
+		for(; end - s >= 16 && pos + 16 <= len; s += 16, pos += 16) {
+			__m128i v = _mm_loadu_si128((const __m128i*)s);
+			if(_mm_movemask_epi8(v))
+				break;
+			_mm_storeu_si128((__m128i*)(u16 + pos), _mm_unpacklo_epi8(v, zero));
+			_mm_storeu_si128((__m128i*)(u16 + pos + 8), _mm_unpackhi_epi8(v, zero));
+		}
+		// finish the block that stopped the vector loop one character at a time
+		stop = end - s > 16 ? s + 16 : end;
+#endif
+		while(s < stop) {
+			unsigned char c = *s;
+			if(c < 0x80) {
+				PUT(c);
+				s++;
+			}
+			else if(c < 0xC2 || c > 0xF4 || !IS_CONT(s[1])) {
+				// a stray continuation byte, overlong 2 byte lead, lead past U+10FFFF, or truncated sequence
+				// overlong 2 byte sequences with a continuation byte are skipped whole
+				if(c == 0xC0 || c == 0xC1)
+					s += 1 + IS_CONT(s[1]);
+				else s++;
+				++*err;
+			}
+			else if(c < 0xE0) {
+				PUT(((c & 0x1F) << 6) | (s[1] & 0x3F));
+				s += 2;
+			}
+			else if(c < 0xF0) {
+				if(!IS_CONT(s[2])) {
+					s++;
+					++*err;
+					continue;
+				}
+				uint16_t cp = ((c & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+				s += 3;
+				if(cp < 0x800 || (cp >= 0xD800 && cp < 0xE000)) {
+					++*err;
+					continue;
+				}
+				PUT(cp);
+			}
+			else {
+				if(!IS_CONT(s[2]) || !IS_CONT(s[3])) {
+					s++;
+					++*err;
+					continue;
+				}
+				uint32_t cp = ((c & 0x07) << 18) | ((s[1] & 0x3F) << 12) | ((s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+				s += 4;
+				if(cp < 0x10000 || cp > 0x10FFFF) {
+					++*err;
+					continue;
+				}
+				cp -= 0x10000;
+				PUT(0xD800 | (cp >> 10));
+				PUT(0xDC00 | (cp & 0x3FF));
+			}
+		}
+	}
+#undef PUT
+#undef IS_CONT
+	return pos;
+}
+
+static ssize_t hfs_unistr_to_utf8_impl(const hfs_unistr255_t* u16, char* u8, bool pathname) {
 	int err;
-	ssize_t len = utf16_to_utf8(u8,HFS_NAME_MAX,u16->unicode,u16->length,0,&err);
+	ssize_t len;
+	if(!u8 || u16->length > 255)
+		len = utf16_to_utf8(u8,HFS_NAME_MAX,u16->unicode,u16->length,0,&err);
+	else len = hfs_utf16_to_utf8(u8,u16->unicode,u16->length,pathname,&err);
 	if(u8)
 		u8[len] = '\0';
 	return err ? -err : len;
 }
 
+ssize_t hfs_unistr_to_utf8(const hfs_unistr255_t* u16, char* u8) {
+	return hfs_unistr_to_utf8_impl(u16, u8, false);
+}
+
 ssize_t hfs_utf8_to_unistr(const char* u8, hfs_unistr255_t* u16) {
 	int err;
-	u16->length = utf8_to_utf16(u16->unicode, 255, u8, strlen(u8), 0, &err);
-	return err ? -err : u16->length;
+	size_t len = hfs_utf8_to_utf16(u16->unicode, 255, u8, &err);
+	u16->length = len > 255 ? 255 : len;
+	if(err)
+		return -err;
+	return len > 255 ? -ENAMETOOLONG : (ssize_t)len;
 }
 
 ssize_t hfs_pathname_to_unix(const hfs_unistr255_t* u16, char* u8) {
-	ssize_t ret = hfs_unistr_to_utf8(u16, u8);
-	if(ret > 0 && u8)
+	ssize_t ret = hfs_unistr_to_utf8_impl(u16, u8, true);
+	if(ret > 0 && u8 && u16->length > 255)
 		for(char* rep = u8; (rep = strchr(rep,'/')); rep++)
 			*rep = ':';
 	return ret;
 }
 
-#ifdef HAVE_UTF8PROC
-
 // According to Apple Technical Q&A #QA1173,
 // "HFS Plus (Mac OS Extended) uses a variant of Normal Form D in which U+2000 through U+2FFF, U+F900 through U+FAFF, and U+2F800 through U+2FAFF are not decomposed"
 // However TN1150 makes no mention of the U+2xxxx range and states that Unicode 2.0 (which predates these) be strictly followed
 // experiments suggest that codepoints over U+FFFF are passed through silently and do not even undergo combining character ordering
-#define HFSINRANGE(codepoint) ( \
-	((codepoint) >= 0x0000 && (codepoint) <= 0xFFFF) &&  \
-	!(((codepoint) >= 0x2000 && (codepoint) <= 0x2FFF) ||\
-	  ((codepoint) >= 0xF900 && (codepoint) <= 0xFAFF))  \
-)
+// nfd_data.h holds the decompositions and combining classes for exactly that range, everything outside of it has neither
+// see data/gen_nfd_data.c for how it's generated
+#include "nfd_data.h"
+
+#define HANGUL_SBASE 0xAC00
+#define HANGUL_LBASE 0x1100
+#define HANGUL_VBASE 0x1161
+#define HANGUL_TBASE 0x11A7
+#define HANGUL_SCOUNT 11172
+#define HANGUL_NCOUNT 588
+#define HANGUL_TCOUNT 28
+
+static inline uint8_t hfs_combining_class(int32_t codepoint) {
+	// nothing below U+0300 combines
+	if(codepoint < 0x300 || codepoint > 0xFFFF)
+		return 0;
+	return hfs_ccc_blocks[hfs_ccc_index[codepoint >> HFS_NFD_BLOCK_SHIFT]][codepoint & ((1 << HFS_NFD_BLOCK_SHIFT) - 1)];
+}
 
-static inline void sort_combining_characters(utf8proc_int32_t* buf, size_t len) {
+static inline void sort_combining_characters(int32_t* buf, size_t len) {
 	if(len <= 1)
 		return;
 
-	utf8proc_propval_t rclass = utf8proc_get_property(buf[1])->combining_class;
-	if(HFSINRANGE(buf[0]) && HFSINRANGE(buf[1]) && rclass && utf8proc_get_property(buf[0])->combining_class > rclass) {
-		utf8proc_int32_t tmp = buf[0];
+	uint8_t rclass = hfs_combining_class(buf[1]);
+	if(rclass && hfs_combining_class(buf[0]) > rclass) {
+		int32_t tmp = buf[0];
 		buf[0] = buf[1];
 		buf[1] = tmp;
 	}
 
 	for(size_t i = 1; i < len - 1; ) {
-		rclass = utf8proc_get_property(buf[i+1])->combining_class;
-		if(!(rclass && HFSINRANGE(buf[i+1])))
+		rclass = hfs_combining_class(buf[i+1]);
+		if(!rclass)
 			i += 2;
-		else if(HFSINRANGE(buf[i]) && utf8proc_get_property(buf[i])->combining_class > rclass) {
-			utf8proc_int32_t tmp = buf[i];
+		else if(hfs_combining_class(buf[i]) > rclass) {
+			int32_t tmp = buf[i];
 			buf[i] = buf[i+1];
 			buf[i+1] = tmp;
 			i--;
@@ -137,49 +310,136 @@ static inline void sort_combining_characters(utf8proc_int32_t* buf, size_t len)
 	}
 }
 
-static char* hfs_utf8proc_NFD(const uint8_t* u8) {
-	utf8proc_int32_t codepoint,* buf;
-	utf8proc_ssize_t ct, result;
+// strict UTF-8 decoding, rejecting overlong forms, surrogates, and anything past U+10FFFF
+// returns the length of the sequence or 0 if it's invalid
+static inline int hfs_utf8_decode(const uint8_t* u8, int32_t* codepoint) {
+	uint8_t c = u8[0];
+	if(c < 0x80) {
+		*codepoint = c;
+		return 1;
+	}
+	if((uint8_t)(c - 0xC2) > 0xF4 - 0xC2)
+		return 0;
+	if(c < 0xE0) {
+		if((u8[1] & 0xC0) != 0x80)
+			return 0;
+		*codepoint = ((c & 0x1F) << 6) | (u8[1] & 0x3F);
+		return 2;
+	}
+	if(c < 0xF0) {
+		if((u8[1] & 0xC0) != 0x80 || (u8[2] & 0xC0) != 0x80 || (c == 0xE0 && u8[1] < 0xA0) || (c == 0xED && u8[1] > 0x9F))
+			return 0;
+		*codepoint = ((c & 0x0F) << 12) | ((u8[1] & 0x3F) << 6) | (u8[2] & 0x3F);
+		return 3;
+	}
+	if((u8[1] & 0xC0) != 0x80 || (u8[2] & 0xC0) != 0x80 || (u8[3] & 0xC0) != 0x80 || (c == 0xF0 && u8[1] < 0x90) || (c == 0xF4 && u8[1] > 0x8F))
+		return 0;
+	*codepoint = ((c & 0x07) << 18) | ((u8[1] & 0x3F) << 12) | ((u8[2] & 0x3F) << 6) | (u8[3] & 0x3F);
+	return 4;
+}
+
+// decomposes u8 straight into u16, with ':' swapped for '/'
+// every codepoint takes at least one UTF-16 unit, so a fixed buffer holds the decomposition of any name that fits
+static int hfs_NFD(const uint8_t* u8, hfs_unistr255_t* u16) {
+	int32_t codepoint, buf[256];
 	size_t len = 0;
-	for(const uint8_t* it = u8; *it && (result = utf8proc_iterate(it, -1, &codepoint)) > 0; it += result) {
-		if(HFSINRANGE(codepoint)) {
-			if((ct = utf8proc_decompose_char(codepoint, NULL, 0, UTF8PROC_DECOMPOSE, NULL)) > 0)
-				len += ct;
-			else {
-				len = 0;
-				break;
-			}
+	// reordering only ever swaps a combining character with a preceding one of a higher class, so track whether that happens at all
+	// decompositions in the table are already in canonical order and only need checking at their ends
+	uint8_t lastclass = 0, cc;
+	bool ordered = true;
+	for(int result; *u8; u8 += result) {
+		if(!(result = hfs_utf8_decode(u8, &codepoint)))
+			return -EINVAL;
+		if(len == 255)
+			return -EINVAL;
+		if(codepoint > 0xFFFF) {
+			buf[len++] = codepoint;
+			lastclass = 0;
+			continue;
 		}
-		else len++;
+		int32_t sindex = codepoint - HANGUL_SBASE;
+		if(sindex >= 0 && sindex < HANGUL_SCOUNT) {
+			int32_t tindex = sindex % HANGUL_TCOUNT;
+			if(len + 2 + !!tindex > 255)
+				return -EINVAL;
+			buf[len++] = HANGUL_LBASE + sindex / HANGUL_NCOUNT;
+			buf[len++] = HANGUL_VBASE + (sindex % HANGUL_NCOUNT) / HANGUL_TCOUNT;
+			if(tindex)
+				buf[len++] = HANGUL_TBASE + tindex;
+			lastclass = 0;
+			continue;
+		}
+		uint16_t d = hfs_decomp_blocks[hfs_decomp_index[codepoint >> HFS_NFD_BLOCK_SHIFT]][codepoint & ((1 << HFS_NFD_BLOCK_SHIFT) - 1)];
+		if(!d) {
+			cc = hfs_combining_class(codepoint);
+			ordered &= !cc || cc >= lastclass;
+			lastclass = cc;
+			buf[len++] = codepoint;
+			continue;
+		}
+		const uint16_t* seq = hfs_decomp_seq + d;
+		if(len + seq[0] > 255)
+			return -EINVAL;
+		cc = hfs_combining_class(seq[1]);
+		ordered &= !cc || cc >= lastclass;
+		for(uint16_t i = 1; i <= seq[0]; i++)
+			buf[len++] = seq[i];
+		lastclass = hfs_combining_class(seq[seq[0]]);
 	}
 
-	if(!len || result < 0 || !(buf = malloc(sizeof(*buf)*len+1))) //trailing byte for utf8proc_reencode
-		return NULL;
-
-	for(utf8proc_int32_t* it = buf; *u8 && (result = utf8proc_iterate(u8, -1, &codepoint)) > 0; u8 += result)
-		if(HFSINRANGE(codepoint))
-			it += utf8proc_decompose_char(codepoint, it, buf+len-it, UTF8PROC_DECOMPOSE, NULL);
-		else *it++ = codepoint;
-
-	sort_combining_characters(buf, len);
-	utf8proc_reencode(buf, len, 0);
-	return (char*)buf;
+	if(!ordered)
+		sort_combining_characters(buf, len);
+
+	u16->length = 0;
+	for(size_t i = 0; i < len; i++) {
+		codepoint = buf[i] == ':' ? '/' : buf[i];
+		if(codepoint > 0xFFFF) {
+			if(u16->length + 2 > 255)
+				return -EINVAL;
+			codepoint -= 0x10000;
+			u16->unicode[u16->length++] = 0xD800 | (codepoint >> 10);
+			u16->unicode[u16->length++] = 0xDC00 | (codepoint & 0x3FF);
+		}
+		else if(u16->length < 255)
+			u16->unicode[u16->length++] = codepoint;
+		else return -EINVAL;
+	}
+	return 0;
 }
 
-#else
-#define hfs_utf8proc_NFD(x) strdup((const char*)(x))
+// names made up entirely of ASCII are already decomposed, and only need ':' swapped for '/' as they're widened
+// returns false if u8 contains anything else or is too long
+static bool hfs_ascii_pathname_from_unix(const char* u8, hfs_unistr255_t* u16) {
+	size_t len = strlen(u8);
+	if(len > 255)
+		return false;
+	size_t i = 0;
+#ifdef __SSE2__
+	const __m128i colon = _mm_set1_epi8(':'), slash = _mm_set1_epi8('/'), zero = _mm_setzero_si128();
+	for(; i + 16 <= len; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i*)(u8 + i));
+		if(_mm_movemask_epi8(v))
+			return false;
+		__m128i is_colon = _mm_cmpeq_epi8(v, colon);
+		v = _mm_or_si128(_mm_andnot_si128(is_colon, v), _mm_and_si128(is_colon, slash));
+		_mm_storeu_si128((__m128i*)(u16->unicode + i), _mm_unpacklo_epi8(v, zero));
+		_mm_storeu_si128((__m128i*)(u16->unicode + i + 8), _mm_unpackhi_epi8(v, zero));
+	}
 #endif
+	for(; i < len; i++) {
+		unsigned char c = u8[i];
+		if(c >= 0x80)
+			return false;
+		u16->unicode[i] = c == ':' ? '/' : c;
+	}
+	u16->length = len;
+	return true;
+}
 
 int hfs_pathname_from_unix(const char* u8, hfs_unistr255_t* u16) {
-	char* norm = (char*)hfs_utf8proc_NFD((const uint8_t*)u8);
-	if(!norm)
-		return -ENOMEM;
-	char* rep = norm;
-	while((rep = strchr(rep,':')))
-		*rep++ = '/';
-	ssize_t err = hfs_utf8_to_unistr(norm,u16);
-	free(norm);
-	return err < 0 ? -EINVAL : 0;
+	if(hfs_ascii_pathname_from_unix(u8, u16))
+		return 0;
+	return hfs_NFD((const uint8_t*)u8, u16);
 }
 
 // libhfs has `hfslib_path_elements_to_cnid` but we want to be able to use our hfs_pathname_to_unix on the individual elements
@@ -239,6 +499,60 @@ static inline void* hfs_memdup(const void* ptr, size_t size) {
 	return memcpy(p,ptr,size);
 }
 
+// finds name in the folder parent_cnid, resolving directory hard links but not file ones
+static int hfs_lookup_name(hfs_volume* vol, hfs_cnid_t parent_cnid, const char* name, hfs_catalog_key_t* key, hfs_catalog_keyed_record_t* record) {
+	struct hfs_device* dev = vol->cbdata;
+	hfs_unistr255_t upath;
+	int ret;
+	if((ret = hfs_pathname_from_unix(name,&upath)))
+		return ret;
+
+	if(!hfslib_make_catalog_key(parent_cnid,upath.length,upath.unicode,key))
+		return -EINVAL;
+
+	// components are cached under the name in the form the catalog compares it in, so that e.g. case variants
+	// share an entry. the volume is read only, so names known to be missing also stay that way
+	hfs_catalog_key_t folded;
+	const hfs_unistr255_t* cached_name = &key->name;
+	if((dev->dentry_cache || dev->negative_cache) && vol->keycmp == hfslib_compare_catalog_keys_cf) {
+		hfslib_fold_catalog_key(key, &folded);
+		cached_name = &folded.name;
+	}
+
+	if(hfs_dentry_cache_lookup(dev->dentry_cache, key->parent_cnid, cached_name, record))
+		return 0;
+	if(hfs_negative_cache_lookup(dev->negative_cache, key->parent_cnid, cached_name))
+		return -ENOENT;
+
+	int found = hfslib_find_catalog_record_with_key(vol,key,record,NULL);
+	if(found) {
+		if(found < 0)
+			hfs_negative_cache_add(dev->negative_cache, key->parent_cnid, cached_name);
+		return -ENOENT;
+	}
+
+	// resolve directory hard links so that lookup can continue through them
+	hfs_catalog_keyed_record_t inode_rec;
+	if(record->type == HFS_REC_FILE &&
+	   record->file.user_info.file_creator == HFS_MACS_CREATOR &&
+	   record->file.user_info.file_type == HFS_DIR_HARD_LINK_FILE_TYPE &&
+	   !hfslib_get_directory_hardlink(vol, record->file.bsd.special.inode_num, &inode_rec, NULL))
+		*record = inode_rec;
+
+	hfs_dentry_cache_add(dev->dentry_cache, key->parent_cnid, cached_name, record);
+	return 0;
+}
+
+// replaces a file hard link's record with that of its target
+static void hfs_resolve_file_hardlink(hfs_volume* vol, hfs_catalog_keyed_record_t* record) {
+	hfs_catalog_keyed_record_t inode_rec;
+	if(record->type == HFS_REC_FILE &&
+	   record->file.user_info.file_creator == HFS_HFSPLUS_CREATOR &&
+	   record->file.user_info.file_type == HFS_HARD_LINK_FILE_TYPE &&
+	   !hfslib_get_hardlink(vol, record->file.bsd.special.inode_num, &inode_rec, NULL))
+		   *record = inode_rec;
+}
+
 int hfs_lookup(hfs_volume* vol, const char* path, hfs_catalog_keyed_record_t* record, hfs_catalog_key_t* key, uint8_t* fork) {
 	hfs_catalog_key_t key_buf;
 	if(!key)
@@ -275,8 +589,6 @@ int hfs_lookup(hfs_volume* vol, const char* path, hfs_catalog_keyed_record_t* re
 	if(alt_fork_lookup)
 		pathcpy[pathlen - dev->rsrc_len] = '\0';
 
-	hfs_catalog_keyed_record_t inode_rec; //for resolving hard links
-
 	// lookup normally ends when either the path is exhasuted or a file is found, however there are exactly two cases
 	// where a file is permitted as part of the path: hard links to other directories, or when accessing a file's
 	// resource fork via the special /rsrc suffix
@@ -284,29 +596,10 @@ int hfs_lookup(hfs_volume* vol, const char* path, hfs_catalog_keyed_record_t* re
 	    pelem;
 		pelem = strtok_r(NULL,"/",&state)) {
 
-		hfs_unistr255_t upath;
-		if((ret = hfs_pathname_from_unix(pelem,&upath)))
+		if((ret = hfs_lookup_name(vol,record->folder.cnid,pelem,key,record)))
 			goto end;
 
-		if(!hfslib_make_catalog_key(record->folder.cnid,upath.length,upath.unicode,key)) {
-			ret = -EINVAL;
-			goto end;
-		}
-
-		if(hfslib_find_catalog_record_with_key(vol,key,record,NULL)) {
-			ret = -ENOENT;
-			goto end;
-		}
-
 		if(record->type == HFS_REC_FILE) {
-			if(record->file.user_info.file_creator == HFS_MACS_CREATOR &&
-			   record->file.user_info.file_type == HFS_DIR_HARD_LINK_FILE_TYPE &&
-			   !hfslib_get_directory_hardlink(vol, record->file.bsd.special.inode_num, &inode_rec, NULL)) {
-				// resolve directory hard links and resume path traversal
-				*record = inode_rec;
-				continue;
-			}
-
 			if((pelem = strtok_r(NULL,"/",&state)) && !(alt_fork_lookup = !strcmp(pelem,"rsrc"))) {
 				// a file was found, but there are trailing path elements
 				// only allowed in the case of filename/rsrc for alternate fork lookup
@@ -318,12 +611,7 @@ int hfs_lookup(hfs_volume* vol, const char* path, hfs_catalog_keyed_record_t* re
 		}
 	}
 
-	// resolve regular hard links
-	if(record->type == HFS_REC_FILE &&
-	   record->file.user_info.file_creator == HFS_HFSPLUS_CREATOR &&
-	   record->file.user_info.file_type == HFS_HARD_LINK_FILE_TYPE &&
-	   !hfslib_get_hardlink(vol, record->file.bsd.special.inode_num, &inode_rec, NULL))
-		   *record = inode_rec;
+	hfs_resolve_file_hardlink(vol,record);
 
 	if(!alt_fork_lookup) // don't cache alternate fork lookups
 		hfs_record_cache_add(cache,path,pathlen,record);
@@ -335,6 +623,31 @@ end:
 	return ret;
 }
 
+int hfs_lookup_child(hfs_volume* vol, hfs_cnid_t parent_cnid, const char* name, hfs_catalog_keyed_record_t* record, uint8_t* fork) {
+	struct hfs_device* dev = vol->cbdata;
+	if(fork)
+		*fork = dev->default_fork;
+
+	size_t namelen = strlen(name);
+	char namebuf[HFS_NAME_MAX+1];
+	if(dev->rsrc_suff && dev->rsrc_len < namelen && !memcmp(name + namelen - dev->rsrc_len, dev->rsrc_suff, dev->rsrc_len)) {
+		namelen -= dev->rsrc_len;
+		if(namelen > HFS_NAME_MAX)
+			return -ENAMETOOLONG;
+		memcpy(namebuf,name,namelen);
+		namebuf[namelen] = '\0';
+		name = namebuf;
+		if(fork)
+			*fork = ~*fork;
+	}
+
+	hfs_catalog_key_t key;
+	int ret = hfs_lookup_name(vol,parent_cnid,name,&key,record);
+	if(!ret)
+		hfs_resolve_file_hardlink(vol,record);
+	return ret;
+}
+
 // POSIX 08 specifies values for all file modes below 07777 but leaves the following to the implementation
 // so for these we translate to the system's modes from the definitions given in TN1150
 #ifndef S_IFLNK
@@ -361,16 +674,50 @@ end:
 	X(S_IFSOCK,HFS_S_IFSOCK)\
 	X(S_IFWHT, HFS_S_IFWHT)
 
-void hfs_stat_with_decmpfs_header(hfs_volume* vol, hfs_catalog_keyed_record_t* rec, struct stat* st, uint8_t fork, struct hfs_decmpfs_header* decmpfs_header) {
+void hfs_dirent_from_record(const hfs_catalog_keyed_record_t* rec, uint8_t fork, struct hfs_dirent* ent) {
+	// the fields shared by files and folders are at the same offsets in both records
+	ent->cnid = rec->file.cnid;
+	ent->name = 0;
+	ent->type = rec->type;
+	ent->file_mode = rec->file.bsd.file_mode;
+	ent->owner_id = rec->file.bsd.owner_id;
+	ent->group_id = rec->file.bsd.group_id;
+	ent->admin_flags = rec->file.bsd.admin_flags;
+	ent->owner_flags = rec->file.bsd.owner_flags;
+	ent->date_created = rec->file.date_created;
+	ent->date_content_mod = rec->file.date_content_mod;
+	ent->date_attrib_mod = rec->file.date_attrib_mod;
+	ent->date_accessed = rec->file.date_accessed;
+	ent->date_backedup = rec->file.date_backedup;
+	ent->link = 0;
+	ent->pos = 0;
+	// only the data fork is presented decompressed
+	ent->decmpfs = fork == HFS_DATAFORK ? 0 : HFS_DIRENT_UNCOMPRESSED;
+	if(rec->type == HFS_REC_FILE) {
+		const hfs_fork_t* f = fork == HFS_DATAFORK ? &rec->file.data_fork : &rec->file.rsrc_fork;
+		ent->finder_flags = rec->file.user_info.finder_flags;
+		ent->special = rec->file.bsd.special.raw_device;
+		ent->logical_size = f->logical_size;
+		ent->total_blocks = f->total_blocks;
+	}
+	else {
+		ent->finder_flags = rec->folder.user_info.finder_flags;
+		ent->special = rec->folder.valence;
+		ent->logical_size = 0;
+		ent->total_blocks = 0;
+	}
+}
+
+void hfs_dirent_stat_with_decmpfs_header(hfs_volume* vol, const struct hfs_dirent* ent, struct stat* st, struct hfs_decmpfs_header* decmpfs_header) {
 	memset(st,0,sizeof(*st));
 
-	st->st_ino = rec->file.cnid;
+	st->st_ino = ent->cnid;
 
 	struct hfs_device* dev = vol->cbdata;
 
 	// per TN1150, in this case the mode, user, and group are treated as uninitialized and should use defaults
-	if(!(rec->file.bsd.file_mode & HFS_S_IFMT)) {
-		if(rec->type == HFS_REC_FILE) {
+	if(!(ent->file_mode & HFS_S_IFMT)) {
+		if(ent->type == HFS_REC_FILE) {
 			st->st_mode = dev->default_file_mode | S_IFREG;
 		} else {
 			st->st_mode = dev->default_dir_mode | S_IFDIR;
@@ -378,64 +725,63 @@ void hfs_stat_with_decmpfs_header(hfs_volume* vol, hfs_catalog_keyed_record_t* r
 		st->st_uid = dev->default_uid;
 		st->st_gid = dev->default_gid;
 	} else {
-		st->st_mode  = rec->file.bsd.file_mode & 0xFFF;
+		st->st_mode  = ent->file_mode & 0xFFF;
 
-		#define X(mode,mask) if((rec->file.bsd.file_mode & mask) == mask) st->st_mode |= mode;
+		#define X(mode,mask) if((ent->file_mode & mask) == mask) st->st_mode |= mode;
 		HFS_IFMODES
 		#undef X
 
 		if(dev->disable_symlinks && S_ISLNK(st->st_mode))
 			st->st_mode = (st->st_mode & ~S_IFLNK) | S_IFREG;
 
-		if(rec->file.bsd.owner_id > UID_MAX) {
-			hfslib_error("hfs_stat: owner_id %" PRIu32 " too large for CNID %" PRIu32 ", using default",NULL,0,rec->file.bsd.owner_id,rec->file.cnid);
+		if(ent->owner_id > UID_MAX) {
+			hfslib_error("hfs_stat: owner_id %" PRIu32 " too large for CNID %" PRIu32 ", using default",NULL,0,ent->owner_id,ent->cnid);
 			st->st_uid = dev->default_uid;
 		}
-		else st->st_uid = rec->file.bsd.owner_id;
+		else st->st_uid = ent->owner_id;
 
-		if(rec->file.bsd.group_id > GID_MAX) {
-			hfslib_error("hfs_stat: group_id %" PRIu32 " too large for CNID %" PRIu32 ", using default",NULL,0,rec->file.bsd.group_id,rec->file.cnid);
+		if(ent->group_id > GID_MAX) {
+			hfslib_error("hfs_stat: group_id %" PRIu32 " too large for CNID %" PRIu32 ", using default",NULL,0,ent->group_id,ent->cnid);
 			st->st_gid = dev->default_gid;
 		}
-		else st->st_gid = rec->file.bsd.group_id;
+		else st->st_gid = ent->group_id;
 	}
 
 #if HAVE_STAT_FLAGS
-	st->st_flags = (rec->file.bsd.admin_flags << 16) | rec->file.bsd.owner_flags;
+	st->st_flags = (ent->admin_flags << 16) | ent->owner_flags;
 #ifdef UF_HIDDEN
 	//infer UF_HIDDEN from the kIsInvisible Finder flag
-	if(rec->file.user_info.finder_flags & 0x4000)
+	if(ent->finder_flags & 0x4000)
 		st->st_flags |= UF_HIDDEN;
 #endif
 #endif
-	if(S_ISBLK(st->st_mode) || S_ISCHR(st->st_mode))
-		st->st_rdev = rec->file.bsd.special.raw_device;
-	else st->st_nlink = rec->file.bsd.special.link_count;
-
-	st->st_atime = HFSTIMETOEPOCH(rec->file.date_accessed);
-	st->st_mtime = HFSTIMETOEPOCH(rec->file.date_content_mod);
-	st->st_ctime = HFSTIMETOEPOCH(rec->file.date_attrib_mod);
+	st->st_atime = HFSTIMETOEPOCH(ent->date_accessed);
+	st->st_mtime = HFSTIMETOEPOCH(ent->date_content_mod);
+	st->st_ctime = HFSTIMETOEPOCH(ent->date_attrib_mod);
 #if HAVE_BIRTHTIME
-	st->st_birthtime = HFSTIMETOEPOCH(rec->file.date_created);
+	st->st_birthtime = HFSTIMETOEPOCH(ent->date_created);
 #endif
-	if(rec->type == HFS_REC_FILE) {
-		hfs_fork_t* f = fork == HFS_DATAFORK ? &rec->file.data_fork : &rec->file.rsrc_fork;
-		uint64_t logical_size = decmpfs_header ? decmpfs_header->logical_size : f->logical_size;
+	if(ent->type == HFS_REC_FILE) {
+		if(S_ISBLK(st->st_mode) || S_ISCHR(st->st_mode))
+			st->st_rdev = ent->special;
+		else st->st_nlink = ent->special;
+
+		uint64_t logical_size = decmpfs_header ? decmpfs_header->logical_size : ent->logical_size;
 		if(generic_int_max(st->st_size) < logical_size)
-			hfslib_error("hfs_stat: logical_size %" PRIu64 " too large for CNID %" PRIu32,NULL,0,logical_size,rec->file.cnid);
+			hfslib_error("hfs_stat: logical_size %" PRIu64 " too large for CNID %" PRIu32,NULL,0,logical_size,ent->cnid);
 		else
 			st->st_size = logical_size;
 #if HAVE_STAT_BLOCKS
-		uint64_t nblocks = f->total_blocks * (uint64_t)(vol->vh.block_size/512);
+		uint64_t nblocks = ent->total_blocks * (uint64_t)(vol->vh.block_size/512);
 		if(generic_int_max(st->st_blocks) < nblocks)
-			hfslib_error("hfs_stat: total_blocks %" PRIu64 " too large for CNID %" PRIu32,NULL,0,nblocks,rec->file.cnid);
+			hfslib_error("hfs_stat: total_blocks %" PRIu64 " too large for CNID %" PRIu32,NULL,0,nblocks,ent->cnid);
 		else
 			st->st_blocks = nblocks;
 #endif
 #if HAVE_STAT_BLKSIZE
 		size_t blksize = decmpfs_header ? hfs_decmpfs_buffer_size(decmpfs_header) : vol->vh.block_size;
 		if(generic_int_max(st->st_blksize) < blksize)
-			hfslib_error("hfs_stat: block_size %zu too large for CNID %" PRIu32,NULL,0,blksize,rec->file.cnid);
+			hfslib_error("hfs_stat: block_size %zu too large for CNID %" PRIu32,NULL,0,blksize,ent->cnid);
 		else
 			st->st_blksize = blksize;
 #endif
@@ -443,13 +789,13 @@ void hfs_stat_with_decmpfs_header(hfs_volume* vol, hfs_catalog_keyed_record_t* r
 	else {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wtype-limits"
-		bool saturate_st_nlink = generic_int_max(st->st_nlink)-2 < rec->folder.valence;
+		bool saturate_st_nlink = generic_int_max(st->st_nlink)-2 < ent->special;
 #pragma GCC diagnostic pop
 		if(saturate_st_nlink)
 			st->st_nlink = generic_int_max(st->st_nlink);
 		else {
 			//valence must be cast to the type of st_nlink to really guarantee no overflow here, but nlink_t is not always defined (e.g. mingw) hence separate ops
-			st->st_nlink = rec->folder.valence;
+			st->st_nlink = ent->special;
 			st->st_nlink += 2;
 		}
 
@@ -460,6 +806,31 @@ void hfs_stat_with_decmpfs_header(hfs_volume* vol, hfs_catalog_keyed_record_t* r
 	}
 }
 
+void hfs_dirent_stat(hfs_volume* vol, const struct hfs_dirent* ent, struct stat* st) {
+	struct hfs_decmpfs_header h,* hp = NULL;
+	if(ent->type == HFS_REC_FILE && (ent->owner_flags & HFS_UF_COMPRESSED) && ent->decmpfs != HFS_DIRENT_UNCOMPRESSED) {
+		if(ent->decmpfs) {
+			// already looked up by hfs_decmpfs_lookup_batch
+			h.type = ent->decmpfs;
+			h.logical_size = ent->logical_size;
+			hp = &h;
+		}
+		else {
+			// all hfs_decmpfs_lookup needs from the record
+			hfs_file_record_t file = { .cnid = ent->cnid, .bsd.owner_flags = ent->owner_flags, .data_fork.logical_size = ent->logical_size };
+			if(!hfs_decmpfs_lookup(vol,&file,&h,NULL,NULL))
+				hp = &h;
+		}
+	}
+	hfs_dirent_stat_with_decmpfs_header(vol,ent,st,hp);
+}
+
+void hfs_stat_with_decmpfs_header(hfs_volume* vol, hfs_catalog_keyed_record_t* rec, struct stat* st, uint8_t fork, struct hfs_decmpfs_header* decmpfs_header) {
+	struct hfs_dirent ent;
+	hfs_dirent_from_record(rec,fork,&ent);
+	hfs_dirent_stat_with_decmpfs_header(vol,&ent,st,decmpfs_header);
+}
+
 void hfs_stat(hfs_volume* vol, hfs_catalog_keyed_record_t* rec, struct stat* st, uint8_t fork) {
 	struct hfs_decmpfs_header h,* hp = NULL;
 	if(rec->type == HFS_REC_FILE && fork == HFS_DATAFORK && !hfs_decmpfs_lookup(vol,&rec->file,&h,NULL,NULL))
@@ -467,6 +838,138 @@ void hfs_stat(hfs_volume* vol, hfs_catalog_keyed_record_t* rec, struct stat* st,
 	hfs_stat_with_decmpfs_header(vol,rec,st,fork,hp);
 }
 
+hfs_cnid_t hfs_resolve_hardlink(hfs_volume* vol, hfs_catalog_keyed_record_t* rec) {
+	if(rec->type != HFS_REC_FILE)
+		return 0;
+	hfs_cnid_t link = rec->file.cnid;
+	if(rec->file.user_info.file_creator == HFS_HFSPLUS_CREATOR &&
+	   rec->file.user_info.file_type == HFS_HARD_LINK_FILE_TYPE) {
+		if(!hfslib_get_hardlink(vol, rec->file.bsd.special.inode_num, rec, NULL))
+			return link;
+	}
+	else if(rec->file.user_info.file_creator == HFS_MACS_CREATOR &&
+	        rec->file.user_info.file_type == HFS_DIR_HARD_LINK_FILE_TYPE) {
+		if(!hfslib_get_directory_hardlink(vol, rec->file.bsd.special.inode_num, rec, NULL))
+			return link;
+	}
+	return 0;
+}
+
+int hfs_dir_listing_append(struct hfs_dir_listing* listing, const struct hfs_dirent* ent, const char* name, size_t len) {
+	// names are addressed by a 32 bit offset
+	if(listing->count == UINT32_MAX || listing->names_size > UINT32_MAX)
+		return -EOVERFLOW;
+
+	if(listing->count == listing->capacity) {
+		uint32_t capacity = listing->capacity ? listing->capacity*2 : 16;
+		if(capacity < listing->capacity)
+			capacity = UINT32_MAX;
+		struct hfs_dirent* entries = realloc(listing->entries,capacity*sizeof(*entries));
+		if(!entries)
+			return -ENOMEM;
+		listing->entries = entries;
+		listing->capacity = capacity;
+	}
+
+	uint16_t namelen = len;
+	size_t need = listing->names_size + sizeof(namelen) + len + 1;
+	if(need > listing->names_capacity) {
+		size_t capacity = listing->names_capacity*2 > need ? listing->names_capacity*2 : need;
+		char* names = realloc(listing->names,capacity);
+		if(!names)
+			return -ENOMEM;
+		listing->names = names;
+		listing->names_capacity = capacity;
+	}
+
+	char* p = listing->names + listing->names_size;
+	memcpy(p,&namelen,sizeof(namelen));
+	memcpy(p+sizeof(namelen),name,len);
+	p[sizeof(namelen)+len] = '\0';
+
+	struct hfs_dirent* e = listing->entries + listing->count++;
+	*e = *ent;
+	e->name = listing->names_size;
+	listing->names_size = need;
+	return 0;
+}
+
+// gives back the slack from growing a listing's buffers
+static void hfs_dir_listing_trim(struct hfs_dir_listing* listing) {
+	if(!listing->count)
+		return;
+	struct hfs_dirent* entries = realloc(listing->entries,listing->count*sizeof(*entries));
+	if(entries) {
+		listing->entries = entries;
+		listing->capacity = listing->count;
+	}
+	char* names = realloc(listing->names,listing->names_size);
+	if(names) {
+		listing->names = names;
+		listing->names_capacity = listing->names_size;
+	}
+}
+
+int hfs_get_directory_listing(hfs_volume* vol, hfs_cnid_t cnid, struct hfs_dir_listing* listing) {
+	memset(listing,0,sizeof(*listing));
+
+	hfs_dir_cursor_t cursor;
+	if(hfslib_open_directory(vol,cnid,&cursor,NULL))
+		return -EIO;
+
+	hfs_catalog_keyed_record_t rec;
+	hfs_catalog_key_t key;
+	int ret;
+	while(!(ret = hfslib_read_directory(vol,&cursor,&rec,&key,NULL))) {
+		char name[HFS_NAME_MAX+1];
+		ssize_t len = hfs_pathname_to_unix(&key.name,name);
+		// skip names that can't be represented, as readdir does
+		if(len < 0)
+			continue;
+
+		struct hfs_dirent ent;
+		hfs_cnid_t link = hfs_resolve_hardlink(vol,&rec);
+		hfs_dirent_from_record(&rec,HFS_DATAFORK,&ent);
+		ent.link = link;
+		ent.pos = hfslib_tell_directory(&cursor);
+		if((ret = hfs_dir_listing_append(listing,&ent,name,len)))
+			goto error;
+	}
+	if(ret > 0) {
+		ret = -EIO;
+		goto error;
+	}
+
+	// if this fails the entries are just looked up one at a time when they're stat'd
+	hfs_decmpfs_lookup_batch(vol,listing->entries,listing->count);
+	hfs_dir_listing_trim(listing);
+	return 0;
+
+error:
+	hfslib_close_directory(vol,&cursor,NULL);
+	hfs_free_directory_listing(listing);
+	return ret;
+}
+
+void hfs_free_directory_listing(struct hfs_dir_listing* listing) {
+	free(listing->entries);
+	free(listing->names);
+	memset(listing,0,sizeof(*listing));
+}
+
+const struct hfs_dir_listing* hfs_lookup_directory_listing(hfs_volume* vol, hfs_cnid_t cnid) {
+	return hfs_dir_cache_lookup(((struct hfs_device*)vol->cbdata)->dir_cache, cnid);
+}
+
+void hfs_release_directory_listing(hfs_volume* vol, const struct hfs_dir_listing* listing) {
+	hfs_dir_cache_release(((struct hfs_device*)vol->cbdata)->dir_cache, listing);
+}
+
+void hfs_cache_directory_listing(hfs_volume* vol, hfs_cnid_t cnid, struct hfs_dir_listing* listing) {
+	hfs_dir_listing_trim(listing);
+	hfs_dir_cache_add(((struct hfs_device*)vol->cbdata)->dir_cache, cnid, listing);
+}
+
 static inline char* swapcopy(char* buf, char* src, size_t size) {
 	 for(size_t i = 0; i < size; i++)
 		 *buf++ = src[size-i-1];
@@ -499,7 +1002,7 @@ void hfs_serialize_finderinfo(hfs_catalog_keyed_record_t* rec, char buf[32]) {
 }
 
 static void init_libhfs(void) {
-	hfslib_init(&(hfs_callbacks){hfs_vprintf, hfs_malloc, hfs_realloc, hfs_free, hfs_open, hfs_close, hfs_read});
+	hfslib_init(&(hfs_callbacks){hfs_vprintf, hfs_malloc, hfs_realloc, hfs_free, hfs_open, hfs_close, hfs_read, hfs_getnode, hfs_putnode, hfs_releasenode, hfs_readv});
 }
 
 int hfs_open_volume(const char* device, hfs_volume* vol, struct hfs_volume_config* cfg) {
@@ -603,6 +1106,21 @@ int hfs_open(hfs_volume* vol, const char* name, hfs_callback_args* cbargs) {
 	if(cfg.cache_size && !(dev->cache = hfs_record_cache_create(cfg.cache_size)))
 		BAIL(ENOMEM);
 
+	if(cfg.dentry_cache_size && !(dev->dentry_cache = hfs_dentry_cache_create(cfg.dentry_cache_size)))
+		BAIL(ENOMEM);
+
+	if(cfg.negative_cache_size && !(dev->negative_cache = hfs_negative_cache_create(cfg.negative_cache_size)))
+		BAIL(ENOMEM);
+
+	if(cfg.node_cache_size && !(dev->node_cache = hfs_node_cache_create(cfg.node_cache_size)))
+		BAIL(ENOMEM);
+
+	if(cfg.dir_cache_size && cfg.dir_cache_max_bytes && !(dev->dir_cache = hfs_dir_cache_create(cfg.dir_cache_size,cfg.dir_cache_max_bytes)))
+		BAIL(ENOMEM);
+
+	if(cfg.decmpfs_cache_size && !(dev->decmpfs_cache = hfs_decmpfs_cache_create(cfg.decmpfs_cache_size)))
+		BAIL(ENOMEM);
+
 	dev->default_file_mode = cfg.default_file_mode & 0777;
 	dev->default_dir_mode = cfg.default_dir_mode & 0777;
 
@@ -615,6 +1133,12 @@ int hfs_open(hfs_volume* vol, const char* name, hfs_callback_args* cbargs) {
 
 	dev->disable_symlinks = cfg.disable_symlinks;
 
+	// devices with a block size need the aligned reads hfs_read_pread does
+	if(cfg.io_uring && !dev->blksize) {
+		if(!(dev->use_io_uring = hfs_uring_available()))
+			hfslib_error("io_uring is unavailable, falling back to synchronous reads",NULL,0);
+	}
+
 #ifdef HAVE_UBLIO
 	dev->use_ublio = !cfg.noublio;
 	if(dev->use_ublio) {
@@ -657,6 +1181,11 @@ void hfs_close(hfs_volume* vol, hfs_callback_args* cbargs) {
 		return;
 
 	hfs_record_cache_destroy(dev->cache);
+	hfs_record_cache_destroy(dev->dentry_cache);
+	hfs_record_cache_destroy(dev->negative_cache);
+	hfs_node_cache_destroy(dev->node_cache);
+	hfs_dir_cache_destroy(dev->dir_cache);
+	hfs_record_cache_destroy(dev->decmpfs_cache);
 	free(dev->rsrc_suff);
 #ifdef HAVE_UBLIO
 	if(dev->ubfh) {
@@ -678,6 +1207,34 @@ uint32_t hfs_device_block_size(hfs_volume* vol) {
 	return ((struct hfs_device*)vol->cbdata)->blksize;
 }
 
+void hfs_get_record_cache_stats(hfs_volume* vol, struct hfs_record_cache_stats* stats) {
+	hfs_record_cache_stats(((struct hfs_device*)vol->cbdata)->cache, stats);
+}
+
+void hfs_get_dentry_cache_stats(hfs_volume* vol, struct hfs_record_cache_stats* stats) {
+	hfs_record_cache_stats(((struct hfs_device*)vol->cbdata)->dentry_cache, stats);
+}
+
+void hfs_get_negative_cache_stats(hfs_volume* vol, struct hfs_record_cache_stats* stats) {
+	hfs_record_cache_stats(((struct hfs_device*)vol->cbdata)->negative_cache, stats);
+}
+
+void hfs_get_node_cache_stats(hfs_volume* vol, struct hfs_node_cache_stats* stats) {
+	hfs_node_cache_stats(((struct hfs_device*)vol->cbdata)->node_cache, stats);
+}
+
+void hfs_get_decmpfs_cache_stats(hfs_volume* vol, struct hfs_record_cache_stats* stats) {
+	hfs_record_cache_stats(((struct hfs_device*)vol->cbdata)->decmpfs_cache, stats);
+}
+
+struct hfs_record_cache* hfs_volume_decmpfs_cache(hfs_volume* vol) {
+	return ((struct hfs_device*)vol->cbdata)->decmpfs_cache;
+}
+
+void hfs_get_dir_cache_stats(hfs_volume* vol, struct hfs_dir_cache_stats* stats) {
+	hfs_dir_cache_stats(((struct hfs_device*)vol->cbdata)->dir_cache, stats);
+}
+
 #ifdef HAVE_UBLIO
 static inline int hfs_read_ublio(struct hfs_device* dev, void* outbytes, uint64_t length, uint64_t offset) {
 	int ret = 0;
@@ -774,9 +1331,98 @@ end:
 	return ret;
 }
 
+#if HAVE_PREADV
+// segments closer together than this are read with a single preadv, the bytes between them going to hfs_readv_gap
+#define HFS_READV_MAX_GAP 16384
+// never read by anyone, so concurrent reads may all scribble on it
+static char hfs_readv_gap[HFS_READV_MAX_GAP];
+
+static inline bool hfs_preadvall(int d, struct iovec* iov, int iovcnt, off_t offset) {
+	ssize_t bytesread;
+	while(iovcnt && (bytesread = preadv(d,iov,iovcnt,offset)) > 0) {
+		offset += bytesread;
+		for(; iovcnt && (size_t)bytesread >= iov->iov_len; iov++, iovcnt--)
+			bytesread -= iov->iov_len;
+		if(iovcnt) {
+			iov->iov_base = (char*)iov->iov_base + bytesread;
+			iov->iov_len -= bytesread;
+		}
+	}
+	if(iovcnt && !bytesread) {
+		errno = EINVAL; // requested read beyond EOF
+		return false;
+	}
+	return !iovcnt;
+}
+
+static int hfs_readv_preadv(struct hfs_device* dev, const hfs_io_segment_t* segs, uint32_t count, uint64_t base) {
+	struct iovec iov[64];
+	uint32_t i = 0;
+	while(i < count) {
+		uint64_t offset = segs[i].offset, end = offset;
+		int iovcnt = 0;
+		for(; i < count && iovcnt < 63; i++) {
+			if(iovcnt) {
+				if(segs[i].offset < end || segs[i].offset - end > HFS_READV_MAX_GAP)
+					break;
+				if(segs[i].offset > end)
+					iov[iovcnt++] = (struct iovec){hfs_readv_gap, segs[i].offset - end};
+			}
+			iov[iovcnt++] = (struct iovec){segs[i].buffer, segs[i].length};
+			end = segs[i].offset + segs[i].length;
+		}
+		if(!hfs_preadvall(dev->fd,iov,iovcnt,base + offset)) {
+			int ret = -errno;
+			hfslib_error("read of %" PRIu64 " bytes at offset %" PRIu64 " failed: %s",
+			             NULL, 0, end - offset, base + offset, strerror(-ret));
+			return ret;
+		}
+	}
+	return 0;
+}
+#endif
+
+int hfs_readv(hfs_volume* vol, const hfs_io_segment_t* segs, uint32_t count, hfs_callback_args* cbargs) {
+	struct hfs_device* dev = vol->cbdata;
+	if(dev->use_io_uring) {
+		int ret = hfs_uring_readv(dev->fd,segs,count,vol->offset);
+		if(ret != -EOPNOTSUPP) {
+			if(ret)
+				hfslib_error("batch of %" PRIu32 " reads failed: %s",NULL,0,count,strerror(-ret));
+			return ret;
+		}
+	}
+#if HAVE_PREADV
+	bool direct = !dev->blksize;
+#ifdef HAVE_UBLIO
+	direct = direct && !dev->use_ublio;
+#endif
+	if(direct)
+		return hfs_readv_preadv(dev,segs,count,vol->offset);
+#endif
+	for(uint32_t i = 0; i < count; i++) {
+		int ret = hfs_read(vol,segs[i].buffer,segs[i].length,segs[i].offset,cbargs);
+		if(ret)
+			return ret;
+	}
+	return 0;
+}
+
 
 void* hfs_malloc(size_t size, hfs_callback_args* cbargs) { return malloc(size); }
 void* hfs_realloc(void* data, size_t size, hfs_callback_args* cbargs) { return size ? realloc(data,size) : NULL; }
 void  hfs_free(void* data, hfs_callback_args* cbargs) { free(data); }
 
+void* hfs_getnode(hfs_volume* vol, hfs_btree_file_type file, uint32_t node, hfs_callback_args* cbargs) {
+	return hfs_node_cache_lookup(((struct hfs_device*)vol->cbdata)->node_cache, file, node);
+}
+
+void* hfs_putnode(hfs_volume* vol, hfs_btree_file_type file, uint32_t node, void* data, hfs_callback_args* cbargs) {
+	return hfs_node_cache_add(((struct hfs_device*)vol->cbdata)->node_cache, file, node, data);
+}
+
+void hfs_releasenode(hfs_volume* vol, hfs_btree_file_type file, uint32_t node, void* data, hfs_callback_args* cbargs) {
+	hfs_node_cache_release(((struct hfs_device*)vol->cbdata)->node_cache, file, node, data);
+}
+
 void  hfs_vprintf(const char* fmt, const char* file, int line, va_list args) { vfprintf(stderr,fmt,args); putc('\n',stderr); }
@@ -8,6 +8,7 @@
 
 #include <sys/stat.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "libhfs.h"
 
@@ -34,21 +35,27 @@ extern const char hfs_rcsid_libhfs[], hfs_rcsid_unicode[];
 enum hfs_lib_features {
 	HFS_LIB_FEATURES_NONE = 0,
 	HFS_LIB_FEATURES_UBLIO = 1 << 0,
-	HFS_LIB_FEATURES_UTF8PROC = 1 << 1,
+	HFS_LIB_FEATURES_UTF8PROC = 1 << 1, // no longer set, pathnames are normalized with built-in tables
 	HFS_LIB_FEATURES_ZLIB = 1 << 2,
 	HFS_LIB_FEATURES_LZFSE = 1 << 3,
 	HFS_LIB_FEATURES_LZVN = 1 << 4,
+	HFS_LIB_FEATURES_IO_URING = 1 << 5,
 };
 
 enum hfs_lib_features hfs_get_lib_features(void);
 
 const char* hfs_lib_ublio_version(void);
-const char* hfs_lib_utf8proc_version(void);
+const char* hfs_lib_utf8proc_version(void); // always NULL, kept for compatibility
 const char* hfs_lib_zlib_version(void);
 // lzfse and lzvn have no embedded version info
 
 struct hfs_volume_config {
 	size_t cache_size;
+	size_t dentry_cache_size;
+	size_t negative_cache_size;
+	size_t node_cache_size;
+	size_t dir_cache_size, dir_cache_max_bytes;
+	size_t decmpfs_cache_size;
 	uint32_t blksize;
 	char* rsrc_suff;
 	int rsrc_only;
@@ -56,6 +63,8 @@ struct hfs_volume_config {
 	int noublio;
 	int32_t ublio_items;
 	uint64_t ublio_grace;
+	// read file data through io_uring where supported, bypassing ublio
+	int io_uring;
 
 	uint16_t default_file_mode, default_dir_mode;
 	uint32_t default_uid, default_gid;
@@ -63,6 +72,22 @@ struct hfs_volume_config {
 	int disable_symlinks;
 };
 
+struct hfs_record_cache_stats {
+	uint64_t hits, misses, evictions;
+	size_t records, capacity;
+};
+
+struct hfs_node_cache_stats {
+	uint64_t hits, misses, evictions;
+	size_t nodes, capacity;
+};
+
+struct hfs_dir_cache_stats {
+	uint64_t hits, misses, evictions;
+	size_t listings, capacity;
+	size_t bytes, max_bytes;
+};
+
 // HFS+ compression support
 struct hfs_decmpfs_header {
 	uint8_t type;
@@ -71,6 +96,35 @@ struct hfs_decmpfs_header {
 
 struct hfs_decmpfs_context;
 
+#define HFS_DIRENT_UNCOMPRESSED 0xFF
+
+// compact form of a catalog record, holding only what's needed to stat it
+struct hfs_dirent {
+	hfs_cnid_t cnid;
+	uint32_t name; // offset of the entry's name in hfs_dir_listing.names
+	int8_t type; // HFS_REC_FILE or HFS_REC_FLDR
+	uint8_t decmpfs; // decmpfs type set by hfs_decmpfs_lookup_batch, HFS_DIRENT_UNCOMPRESSED if it found no supported header, or 0 if not looked up
+	uint16_t file_mode;
+	uint32_t owner_id, group_id;
+	uint8_t admin_flags, owner_flags;
+	uint16_t finder_flags;
+	uint32_t special; // raw device or link count for files, valence for folders
+	uint32_t date_created, date_content_mod, date_attrib_mod, date_accessed, date_backedup;
+	uint32_t total_blocks;
+	hfs_cnid_t link; // CNID of the hard link this entry was resolved from, 0 if it wasn't a hard link
+	uint64_t logical_size; // uncompressed size once decmpfs is set
+	uint64_t pos; // position of the directory cursor after reading this entry, see hfslib_tell_directory
+};
+
+// the children of a folder in catalog order, with hard links resolved
+// names are packed into a single buffer, each as a uint16_t length followed by the UTF-8 name and a NUL, see hfs_dirent_name
+struct hfs_dir_listing {
+	struct hfs_dirent* entries;
+	uint32_t count, capacity;
+	char* names;
+	size_t names_size, names_capacity;
+};
+
 void hfs_volume_config_defaults(struct hfs_volume_config*);
 
 int hfs_open_volume(const char* device, hfs_volume* vol, struct hfs_volume_config* cfg);
@@ -83,20 +137,62 @@ int hfs_pathname_from_unix(const char* u8, hfs_unistr255_t* u16);
 char* hfs_get_path(hfs_volume* vol, hfs_cnid_t cnid);
 void hfs_cache_path(hfs_volume*, const char* path, size_t len, hfs_catalog_keyed_record_t*);
 int  hfs_lookup(hfs_volume* vol, const char* path, hfs_catalog_keyed_record_t* record, hfs_catalog_key_t* key, uint8_t* fork);
+// looks up a single name in the folder parent_cnid, as hfs_lookup does for each component of a path, with hard links resolved
+// a name ending in rsrc_ext selects the alternate fork. returns 0 or negative errno
+int  hfs_lookup_child(hfs_volume* vol, hfs_cnid_t parent_cnid, const char* name, hfs_catalog_keyed_record_t* record, uint8_t* fork);
 void hfs_stat(hfs_volume* vol, hfs_catalog_keyed_record_t* rec, struct stat* st, uint8_t fork);
 void hfs_stat_with_decmpfs_header(hfs_volume* vol, hfs_catalog_keyed_record_t* rec, struct stat* st, uint8_t fork, struct hfs_decmpfs_header*);
 void hfs_serialize_finderinfo(hfs_catalog_keyed_record_t*, char[32]);
 
+// returns 0 on success or negative errno, the listing must be freed with hfs_free_directory_listing
+int  hfs_get_directory_listing(hfs_volume* vol, hfs_cnid_t cnid, struct hfs_dir_listing* listing);
+void hfs_free_directory_listing(struct hfs_dir_listing* listing);
+// for building a listing one child at a time, copies ent and sets its name to the given one. returns 0 or negative errno
+int  hfs_dir_listing_append(struct hfs_dir_listing* listing, const struct hfs_dirent* ent, const char* name, size_t len);
+// replaces a hard link's record with that of its target, returning the CNID of the link or 0 if rec isn't a hard link
+hfs_cnid_t hfs_resolve_hardlink(hfs_volume* vol, hfs_catalog_keyed_record_t* rec);
+void hfs_dirent_from_record(const hfs_catalog_keyed_record_t* rec, uint8_t fork, struct hfs_dirent* ent);
+void hfs_dirent_stat(hfs_volume* vol, const struct hfs_dirent* ent, struct stat* st);
+void hfs_dirent_stat_with_decmpfs_header(hfs_volume* vol, const struct hfs_dirent* ent, struct stat* st, struct hfs_decmpfs_header*);
+
+// the name of ent in unix form, as produced by hfs_pathname_to_unix
+static inline const char* hfs_dirent_name(const struct hfs_dir_listing* listing, const struct hfs_dirent* ent, size_t* len) {
+	uint16_t namelen;
+	memcpy(&namelen,listing->names+ent->name,sizeof(namelen));
+	if(len)
+		*len = namelen;
+	return listing->names+ent->name+sizeof(namelen);
+}
+
 // 0 if vol is a regular file
 uint32_t hfs_device_block_size(hfs_volume* vol);
 
+// counters for the path lookup, dentry, negative lookup, B-tree node and decmpfs header caches, all zero if disabled
+void hfs_get_record_cache_stats(hfs_volume* vol, struct hfs_record_cache_stats* stats);
+void hfs_get_dentry_cache_stats(hfs_volume* vol, struct hfs_record_cache_stats* stats);
+void hfs_get_negative_cache_stats(hfs_volume* vol, struct hfs_record_cache_stats* stats);
+void hfs_get_node_cache_stats(hfs_volume* vol, struct hfs_node_cache_stats* stats);
+void hfs_get_decmpfs_cache_stats(hfs_volume* vol, struct hfs_record_cache_stats* stats);
+void hfs_get_dir_cache_stats(hfs_volume* vol, struct hfs_dir_cache_stats* stats);
+
+// directory listings shared between callers, keyed by the folder's CNID
+// returns a listing to be released with hfs_release_directory_listing, or NULL if it isn't cached
+const struct hfs_dir_listing* hfs_lookup_directory_listing(hfs_volume* vol, hfs_cnid_t cnid);
+void hfs_release_directory_listing(hfs_volume* vol, const struct hfs_dir_listing* listing);
+// takes ownership of a complete listing of cnid, which is freed if it can't be cached
+void hfs_cache_directory_listing(hfs_volume* vol, hfs_cnid_t cnid, struct hfs_dir_listing* listing);
+
 // libhfs callbacks
 int  hfs_open(hfs_volume*,const char*,hfs_callback_args*);
 void hfs_close(hfs_volume*,hfs_callback_args*);
 int  hfs_read(hfs_volume*,void*,uint64_t,uint64_t,hfs_callback_args*);
+int  hfs_readv(hfs_volume*,const hfs_io_segment_t*,uint32_t,hfs_callback_args*);
 void*hfs_malloc(size_t,hfs_callback_args*);
 void*hfs_realloc(void*,size_t,hfs_callback_args*);
 void hfs_free(void*,hfs_callback_args*);
+void*hfs_getnode(hfs_volume*,hfs_btree_file_type,uint32_t,hfs_callback_args*);
+void*hfs_putnode(hfs_volume*,hfs_btree_file_type,uint32_t,void*,hfs_callback_args*);
+void hfs_releasenode(hfs_volume*,hfs_btree_file_type,uint32_t,void*,hfs_callback_args*);
 void hfs_vprintf(const char*,const char*,int,va_list);
 
 bool hfs_decmpfs_parse_record(struct hfs_decmpfs_header*, uint32_t length, unsigned char* data);
@@ -104,7 +200,7 @@ bool hfs_decmpfs_type_supported(uint8_t type);
 // not required, but useful as a hint for the ideal size to call hfs_decmpfs_read with
 size_t hfs_decmpfs_buffer_size(struct hfs_decmpfs_header* h);
 
-struct hfs_decmpfs_context* hfs_decmpfs_create_context(hfs_volume*, hfs_cnid_t, uint32_t length, unsigned char* data, int* err);
+struct hfs_decmpfs_context* hfs_decmpfs_create_context(hfs_volume*, hfs_file_record_t*, uint32_t length, unsigned char* data, int* err);
 void hfs_decmpfs_destroy_context(struct hfs_decmpfs_context*);
 
 bool hfs_decmpfs_get_header(struct hfs_decmpfs_context*, struct hfs_decmpfs_header*);
@@ -114,7 +210,11 @@ int hfs_decmpfs_read(hfs_volume* vol, struct hfs_decmpfs_context*, char* buf, si
 
 // convenience wrapper to look up and parse the decmpfs attribute for a file if it exists and is supported. the returned data and length may be passed to hfs_decmpfs_create_context
 // returns 0 if this is a compressed file, 1 if not, or negative errno on error
+// results are cached per CNID on volumes opened with a decmpfs cache
 int hfs_decmpfs_lookup(hfs_volume*, hfs_file_record_t*, struct hfs_decmpfs_header*, uint32_t* length, unsigned char** data);
+// looks up the decmpfs headers for all compressed files among entries in CNID order, reading through the attributes tree once rather than searching it for each file
+// sets decmpfs and logical_size in each entry looked up so hfs_dirent_stat can use them. returns 0 or negative errno, in which case the remaining entries are left as they were
+int hfs_decmpfs_lookup_batch(hfs_volume*, struct hfs_dirent* entries, uint32_t count);
 
 // high level file API
 struct hfs_file;
@@ -0,0 +1,879 @@
+// Generated by data/gen_nfd_data.c from utf8proc 2.11.3 (Unicode 17.0.0), do not edit.
+// Codepoints are looked up in 64-entry blocks: table[index[cp >> 6]][cp & 63].
+
+#define HFS_NFD_BLOCK_SHIFT 6
+
+static const uint8_t hfs_ccc_index[1024] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 3, 0, 0, 0, 4, 5, 6, 7, 0, 8, 9, 10, 0, 11,
+	12, 13, 14, 15, 16, 17, 16, 18, 16, 19, 16, 19, 16, 19, 0, 19, 16, 20, 16, 19, 21, 19, 0, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+	31, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 35,
+	0, 0, 36, 0, 37, 0, 0, 0, 38, 39, 40, 41, 42, 43, 44, 45, 46, 0, 0, 47, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	49, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 52, 53, 0, 0, 0, 0,
+	54, 0, 0, 55, 56, 57, 58, 59, 0, 0, 60, 61, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t hfs_ccc_blocks[65][64] = {
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 232, 220, 220, 220, 220, 232, 216, 220, 220, 220, 220,
+		220, 202, 202, 220, 220, 220, 220, 202, 202, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 1, 1, 1, 1, 1, 220, 220, 220, 220, 230, 230, 230,
+	},
+	{
+		230, 230, 230, 230, 230, 240, 230, 220, 220, 220, 230, 230, 230, 220, 220, 0, 230, 230, 230, 220, 220, 220, 220, 230, 232, 220, 220, 230, 233, 234, 234, 233,
+		234, 234, 233, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 230, 230, 230, 230, 220, 230, 230, 230, 222, 220, 230, 230, 230, 230,
+		230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 230, 230, 222, 228, 230, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 0, 23,
+	},
+	{
+		0, 24, 25, 0, 230, 220, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 30, 31, 32, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31, 32, 33, 34, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230,
+		230, 230, 230, 220, 230, 0, 0, 230, 230, 0, 220, 230, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230, 220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230,
+	},
+	{
+		230, 230, 220, 230, 220, 230, 220, 230, 220, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 220, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230,
+		230, 230, 230, 230, 0, 230, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 220, 220, 220, 230, 230, 230, 230,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+		230, 230, 0, 220, 230, 230, 220, 230, 230, 220, 230, 230, 230, 220, 220, 220, 27, 28, 29, 230, 230, 230, 220, 230, 230, 220, 220, 230, 230, 230, 230, 230,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 230, 220, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 84, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 103, 9, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 118, 9, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 122, 122, 122, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 220, 0, 216, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 129, 130, 0, 132, 0, 0, 0, 0, 0, 130, 130, 130, 130, 0, 0,
+	},
+	{
+		130, 0, 230, 230, 9, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 220,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 0, 220,
+	},
+	{
+		220, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 220, 0, 0,
+		230, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230, 234, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0, 1, 220, 220, 220, 220, 220, 230, 230, 220, 220, 220, 220,
+		230, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		230, 230, 220, 230, 230, 230, 230, 230, 230, 230, 220, 230, 230, 234, 214, 220, 202, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+		230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 232, 228, 228, 220, 218, 230, 233, 220, 230, 220,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 228, 232, 222, 224, 224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 230, 230, 220, 0, 0, 230, 230, 0, 0, 0, 0, 0, 230, 230,
+	},
+	{
+		0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		230, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+};
+
+static const uint8_t hfs_decomp_index[1024] = {
+	0, 0, 0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0, 7, 8, 9, 10, 11, 0, 12, 0, 0, 0, 0, 13, 0, 0, 14, 0, 0, 0, 0,
+	0, 0, 0, 0, 15, 16, 0, 17, 18, 19, 0, 0, 0, 20, 21, 22, 0, 23, 0, 24, 0, 25, 0, 26, 0, 0, 0, 0, 0, 27, 28, 0,
+	29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 33, 34, 35, 36, 37, 38, 39,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 40, 41, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t hfs_decomp_blocks[45][64] = {
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1, 4, 7, 10, 13, 16, 0, 19, 22, 25, 28, 31, 34, 37, 40, 43,
+		0, 46, 49, 52, 55, 58, 61, 0, 0, 64, 67, 70, 73, 76, 0, 0,
+		79, 82, 85, 88, 91, 94, 0, 97, 100, 103, 106, 109, 112, 115, 118, 121,
+		0, 124, 127, 130, 133, 136, 139, 0, 0, 142, 145, 148, 151, 154, 0, 157,
+	},
+	{
+		160, 163, 166, 169, 172, 175, 178, 181, 184, 187, 190, 193, 196, 199, 202, 205,
+		0, 0, 208, 211, 214, 217, 220, 223, 226, 229, 232, 235, 238, 241, 244, 247,
+		250, 253, 256, 259, 262, 265, 0, 0, 268, 271, 274, 277, 280, 283, 286, 289,
+		292, 0, 0, 0, 295, 298, 301, 304, 0, 307, 310, 313, 316, 319, 322, 0,
+	},
+	{
+		0, 0, 0, 325, 328, 331, 334, 337, 340, 0, 0, 0, 343, 346, 349, 352,
+		355, 358, 0, 0, 361, 364, 367, 370, 373, 376, 379, 382, 385, 388, 391, 394,
+		397, 400, 403, 406, 409, 412, 0, 0, 415, 418, 421, 424, 427, 430, 433, 436,
+		439, 442, 445, 448, 451, 454, 457, 460, 463, 466, 469, 472, 475, 478, 481, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		484, 487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 490,
+		493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 496, 499, 502,
+		505, 508, 511, 514, 517, 520, 524, 528, 532, 536, 540, 544, 548, 0, 552, 556,
+		560, 564, 568, 571, 0, 0, 574, 577, 580, 583, 586, 589, 592, 596, 600, 603,
+		606, 0, 0, 0, 609, 612, 0, 0, 615, 618, 621, 625, 629, 632, 635, 638,
+	},
+	{
+		641, 644, 647, 650, 653, 656, 659, 662, 665, 668, 671, 674, 677, 680, 683, 686,
+		689, 692, 695, 698, 701, 704, 707, 710, 713, 716, 719, 722, 0, 0, 725, 728,
+		0, 0, 0, 0, 0, 0, 731, 734, 737, 740, 743, 747, 751, 755, 759, 762,
+		765, 769, 773, 776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		779, 781, 0, 783, 785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 790, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 792, 795, 798, 800, 803, 806, 0, 809, 0, 812, 815,
+		818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 822, 825, 828, 831, 834, 837,
+		840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 844, 847, 850, 853, 856, 0,
+		0, 0, 0, 859, 862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		865, 868, 0, 871, 0, 0, 0, 874, 0, 0, 0, 0, 877, 880, 883, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 886, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 889, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		892, 895, 0, 898, 0, 0, 0, 901, 0, 0, 0, 0, 904, 907, 910, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 913, 916, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 919, 922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		925, 928, 931, 934, 0, 0, 937, 940, 0, 0, 943, 946, 949, 952, 955, 958,
+		0, 0, 961, 964, 967, 970, 973, 976, 0, 0, 979, 982, 985, 988, 991, 994,
+		997, 1000, 1003, 1006, 1009, 1012, 0, 0, 1015, 1018, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1021, 1024, 1027, 1030, 1033, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1036, 0, 1039, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1045, 0, 0, 0, 0, 0, 0,
+		0, 1048, 0, 0, 1051, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1054, 1057, 1060, 1063, 1066, 1069, 1072, 1075,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1078, 1081, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1084, 1087, 0, 1090,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1093, 0, 0, 1096, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1099, 1102, 1105, 0, 0, 1108, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 1111, 0, 0, 1114, 1117, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1120, 1123, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1129, 1132, 1135, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 1138, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1141, 0, 0, 0, 0, 0, 0, 1144, 1147, 0, 1150, 1153, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1157, 1160, 1163, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1166, 0, 1169, 1172, 1176, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 1179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1182, 0, 0,
+		0, 0, 1185, 0, 0, 0, 0, 1188, 0, 0, 0, 0, 1191, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1194, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1197, 0, 1200, 1203, 0, 1206, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 1209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1212, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1215, 0, 0,
+		0, 0, 1218, 0, 0, 0, 0, 1221, 0, 0, 0, 0, 1224, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1227, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 1233, 0, 1236, 0, 1239, 0, 1242, 0, 1245, 0,
+		0, 0, 1248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1251, 0, 1254, 0, 0,
+	},
+	{
+		1257, 1260, 0, 1263, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1266, 1269, 1272, 1275, 1278, 1281, 1284, 1287, 1290, 1294, 1298, 1301, 1304, 1307, 1310, 1313,
+		1316, 1319, 1322, 1325, 1328, 1332, 1336, 1340, 1344, 1347, 1350, 1353, 1356, 1360, 1364, 1367,
+		1370, 1373, 1376, 1379, 1382, 1385, 1388, 1391, 1394, 1397, 1400, 1403, 1406, 1409, 1412, 1416,
+		1420, 1423, 1426, 1429, 1432, 1435, 1438, 1441, 1444, 1448, 1452, 1455, 1458, 1461, 1464, 1467,
+	},
+	{
+		1470, 1473, 1476, 1479, 1482, 1485, 1488, 1491, 1494, 1497, 1500, 1503, 1506, 1510, 1514, 1518,
+		1522, 1526, 1530, 1534, 1538, 1541, 1544, 1547, 1550, 1553, 1556, 1559, 1562, 1566, 1570, 1573,
+		1576, 1579, 1582, 1585, 1588, 1592, 1596, 1600, 1604, 1608, 1612, 1615, 1618, 1621, 1624, 1627,
+		1630, 1633, 1636, 1639, 1642, 1645, 1648, 1651, 1654, 1658, 1662, 1666, 1670, 1673, 1676, 1679,
+	},
+	{
+		1682, 1685, 1688, 1691, 1694, 1697, 1700, 1703, 1706, 1709, 1712, 1715, 1718, 1721, 1724, 1727,
+		1730, 1733, 1736, 1739, 1742, 1745, 1748, 1751, 1754, 1757, 0, 1760, 0, 0, 0, 0,
+		1763, 1766, 1769, 1772, 1775, 1779, 1783, 1787, 1791, 1795, 1799, 1803, 1807, 1811, 1815, 1819,
+		1823, 1827, 1831, 1835, 1839, 1843, 1847, 1851, 1855, 1858, 1861, 1864, 1867, 1870, 1873, 1877,
+	},
+	{
+		1881, 1885, 1889, 1893, 1897, 1901, 1905, 1909, 1913, 1916, 1919, 1922, 1925, 1928, 1931, 1934,
+		1937, 1941, 1945, 1949, 1953, 1957, 1961, 1965, 1969, 1973, 1977, 1981, 1985, 1989, 1993, 1997,
+		2001, 2005, 2009, 2013, 2017, 2020, 2023, 2026, 2029, 2033, 2037, 2041, 2045, 2049, 2053, 2057,
+		2061, 2065, 2069, 2072, 2075, 2078, 2081, 2084, 2087, 2090, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		2093, 2096, 2099, 2103, 2107, 2111, 2115, 2119, 2123, 2126, 2129, 2133, 2137, 2141, 2145, 2149,
+		2153, 2156, 2159, 2163, 2167, 2171, 0, 0, 2175, 2178, 2181, 2185, 2189, 2193, 0, 0,
+		2197, 2200, 2203, 2207, 2211, 2215, 2219, 2223, 2227, 2230, 2233, 2237, 2241, 2245, 2249, 2253,
+		2257, 2260, 2263, 2267, 2271, 2275, 2279, 2283, 2287, 2290, 2293, 2297, 2301, 2305, 2309, 2313,
+	},
+	{
+		2317, 2320, 2323, 2327, 2331, 2335, 0, 0, 2339, 2342, 2345, 2349, 2353, 2357, 0, 0,
+		2361, 2364, 2367, 2371, 2375, 2379, 2383, 2387, 0, 2391, 0, 2394, 0, 2398, 0, 2402,
+		2406, 2409, 2412, 2416, 2420, 2424, 2428, 2432, 2436, 2439, 2442, 2446, 2450, 2454, 2458, 2462,
+		2466, 828, 2469, 831, 2472, 834, 2475, 837, 2478, 850, 2481, 853, 2484, 856, 0, 0,
+	},
+	{
+		2487, 2491, 2495, 2500, 2505, 2510, 2515, 2520, 2525, 2529, 2533, 2538, 2543, 2548, 2553, 2558,
+		2563, 2567, 2571, 2576, 2581, 2586, 2591, 2596, 2601, 2605, 2609, 2614, 2619, 2624, 2629, 2634,
+		2639, 2643, 2647, 2652, 2657, 2662, 2667, 2672, 2677, 2681, 2685, 2690, 2695, 2700, 2705, 2710,
+		2715, 2718, 2721, 2725, 2728, 0, 2732, 2735, 2739, 2742, 2745, 795, 2748, 0, 2751, 0,
+	},
+	{
+		0, 2753, 2756, 2760, 2763, 0, 2767, 2770, 2774, 800, 2777, 803, 2780, 2783, 2786, 2789,
+		2792, 2795, 2798, 818, 0, 0, 2802, 2805, 2809, 2812, 2815, 806, 0, 2818, 2821, 2824,
+		2827, 2830, 2833, 840, 2837, 2840, 2843, 2846, 2850, 2853, 2856, 812, 2859, 2862, 792, 2865,
+		0, 0, 2867, 2871, 2874, 0, 2878, 2881, 2885, 809, 2888, 815, 2891, 2894, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2896, 0, 2899, 0,
+		2902, 0, 2905, 0, 2908, 0, 2911, 0, 2914, 0, 2917, 0, 2920, 0, 2923, 0,
+		2926, 0, 2929, 0, 0, 2932, 0, 2935, 0, 2938, 0, 0, 0, 0, 0, 0,
+		2941, 2944, 0, 2947, 2950, 0, 2953, 2956, 0, 2959, 2962, 0, 2965, 2968, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2971, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2974, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2977, 0, 2980, 0,
+		2983, 0, 2986, 0, 2989, 0, 2992, 0, 2995, 0, 2998, 0, 3001, 0, 3004, 0,
+	},
+	{
+		3007, 0, 3010, 0, 0, 3013, 0, 3016, 0, 3019, 0, 0, 0, 0, 0, 0,
+		3022, 3025, 0, 3028, 3031, 0, 3034, 3037, 0, 3040, 3043, 0, 3046, 3049, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 3052, 0, 0, 3055, 3058, 3061, 3064, 0, 0, 0, 3067, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3070, 0, 3073,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3076, 3079, 3082, 3086, 3090, 3093,
+		3096, 3099, 3102, 3105, 3108, 3111, 3114, 0, 3117, 3120, 3123, 3126, 3129, 0, 3132, 0,
+	},
+	{
+		3135, 3138, 0, 3141, 3144, 0, 3147, 3150, 3153, 3156, 3159, 3162, 3165, 3168, 3171, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+};
+
+// each sequence is a length followed by that many UTF-16 units
+static const uint16_t hfs_decomp_seq[3174] = {
+	0x0000, 0x0002, 0x0041, 0x0300, 0x0002, 0x0041, 0x0301, 0x0002, 0x0041, 0x0302, 0x0002, 0x0041,
+	0x0303, 0x0002, 0x0041, 0x0308, 0x0002, 0x0041, 0x030A, 0x0002, 0x0043, 0x0327, 0x0002, 0x0045,
+	0x0300, 0x0002, 0x0045, 0x0301, 0x0002, 0x0045, 0x0302, 0x0002, 0x0045, 0x0308, 0x0002, 0x0049,
+	0x0300, 0x0002, 0x0049, 0x0301, 0x0002, 0x0049, 0x0302, 0x0002, 0x0049, 0x0308, 0x0002, 0x004E,
+	0x0303, 0x0002, 0x004F, 0x0300, 0x0002, 0x004F, 0x0301, 0x0002, 0x004F, 0x0302, 0x0002, 0x004F,
+	0x0303, 0x0002, 0x004F, 0x0308, 0x0002, 0x0055, 0x0300, 0x0002, 0x0055, 0x0301, 0x0002, 0x0055,
+	0x0302, 0x0002, 0x0055, 0x0308, 0x0002, 0x0059, 0x0301, 0x0002, 0x0061, 0x0300, 0x0002, 0x0061,
+	0x0301, 0x0002, 0x0061, 0x0302, 0x0002, 0x0061, 0x0303, 0x0002, 0x0061, 0x0308, 0x0002, 0x0061,
+	0x030A, 0x0002, 0x0063, 0x0327, 0x0002, 0x0065, 0x0300, 0x0002, 0x0065, 0x0301, 0x0002, 0x0065,
+	0x0302, 0x0002, 0x0065, 0x0308, 0x0002, 0x0069, 0x0300, 0x0002, 0x0069, 0x0301, 0x0002, 0x0069,
+	0x0302, 0x0002, 0x0069, 0x0308, 0x0002, 0x006E, 0x0303, 0x0002, 0x006F, 0x0300, 0x0002, 0x006F,
+	0x0301, 0x0002, 0x006F, 0x0302, 0x0002, 0x006F, 0x0303, 0x0002, 0x006F, 0x0308, 0x0002, 0x0075,
+	0x0300, 0x0002, 0x0075, 0x0301, 0x0002, 0x0075, 0x0302, 0x0002, 0x0075, 0x0308, 0x0002, 0x0079,
+	0x0301, 0x0002, 0x0079, 0x0308, 0x0002, 0x0041, 0x0304, 0x0002, 0x0061, 0x0304, 0x0002, 0x0041,
+	0x0306, 0x0002, 0x0061, 0x0306, 0x0002, 0x0041, 0x0328, 0x0002, 0x0061, 0x0328, 0x0002, 0x0043,
+	0x0301, 0x0002, 0x0063, 0x0301, 0x0002, 0x0043, 0x0302, 0x0002, 0x0063, 0x0302, 0x0002, 0x0043,
+	0x0307, 0x0002, 0x0063, 0x0307, 0x0002, 0x0043, 0x030C, 0x0002, 0x0063, 0x030C, 0x0002, 0x0044,
+	0x030C, 0x0002, 0x0064, 0x030C, 0x0002, 0x0045, 0x0304, 0x0002, 0x0065, 0x0304, 0x0002, 0x0045,
+	0x0306, 0x0002, 0x0065, 0x0306, 0x0002, 0x0045, 0x0307, 0x0002, 0x0065, 0x0307, 0x0002, 0x0045,
+	0x0328, 0x0002, 0x0065, 0x0328, 0x0002, 0x0045, 0x030C, 0x0002, 0x0065, 0x030C, 0x0002, 0x0047,
+	0x0302, 0x0002, 0x0067, 0x0302, 0x0002, 0x0047, 0x0306, 0x0002, 0x0067, 0x0306, 0x0002, 0x0047,
+	0x0307, 0x0002, 0x0067, 0x0307, 0x0002, 0x0047, 0x0327, 0x0002, 0x0067, 0x0327, 0x0002, 0x0048,
+	0x0302, 0x0002, 0x0068, 0x0302, 0x0002, 0x0049, 0x0303, 0x0002, 0x0069, 0x0303, 0x0002, 0x0049,
+	0x0304, 0x0002, 0x0069, 0x0304, 0x0002, 0x0049, 0x0306, 0x0002, 0x0069, 0x0306, 0x0002, 0x0049,
+	0x0328, 0x0002, 0x0069, 0x0328, 0x0002, 0x0049, 0x0307, 0x0002, 0x004A, 0x0302, 0x0002, 0x006A,
+	0x0302, 0x0002, 0x004B, 0x0327, 0x0002, 0x006B, 0x0327, 0x0002, 0x004C, 0x0301, 0x0002, 0x006C,
+	0x0301, 0x0002, 0x004C, 0x0327, 0x0002, 0x006C, 0x0327, 0x0002, 0x004C, 0x030C, 0x0002, 0x006C,
+	0x030C, 0x0002, 0x004E, 0x0301, 0x0002, 0x006E, 0x0301, 0x0002, 0x004E, 0x0327, 0x0002, 0x006E,
+	0x0327, 0x0002, 0x004E, 0x030C, 0x0002, 0x006E, 0x030C, 0x0002, 0x004F, 0x0304, 0x0002, 0x006F,
+	0x0304, 0x0002, 0x004F, 0x0306, 0x0002, 0x006F, 0x0306, 0x0002, 0x004F, 0x030B, 0x0002, 0x006F,
+	0x030B, 0x0002, 0x0052, 0x0301, 0x0002, 0x0072, 0x0301, 0x0002, 0x0052, 0x0327, 0x0002, 0x0072,
+	0x0327, 0x0002, 0x0052, 0x030C, 0x0002, 0x0072, 0x030C, 0x0002, 0x0053, 0x0301, 0x0002, 0x0073,
+	0x0301, 0x0002, 0x0053, 0x0302, 0x0002, 0x0073, 0x0302, 0x0002, 0x0053, 0x0327, 0x0002, 0x0073,
+	0x0327, 0x0002, 0x0053, 0x030C, 0x0002, 0x0073, 0x030C, 0x0002, 0x0054, 0x0327, 0x0002, 0x0074,
+	0x0327, 0x0002, 0x0054, 0x030C, 0x0002, 0x0074, 0x030C, 0x0002, 0x0055, 0x0303, 0x0002, 0x0075,
+	0x0303, 0x0002, 0x0055, 0x0304, 0x0002, 0x0075, 0x0304, 0x0002, 0x0055, 0x0306, 0x0002, 0x0075,
+	0x0306, 0x0002, 0x0055, 0x030A, 0x0002, 0x0075, 0x030A, 0x0002, 0x0055, 0x030B, 0x0002, 0x0075,
+	0x030B, 0x0002, 0x0055, 0x0328, 0x0002, 0x0075, 0x0328, 0x0002, 0x0057, 0x0302, 0x0002, 0x0077,
+	0x0302, 0x0002, 0x0059, 0x0302, 0x0002, 0x0079, 0x0302, 0x0002, 0x0059, 0x0308, 0x0002, 0x005A,
+	0x0301, 0x0002, 0x007A, 0x0301, 0x0002, 0x005A, 0x0307, 0x0002, 0x007A, 0x0307, 0x0002, 0x005A,
+	0x030C, 0x0002, 0x007A, 0x030C, 0x0002, 0x004F, 0x031B, 0x0002, 0x006F, 0x031B, 0x0002, 0x0055,
+	0x031B, 0x0002, 0x0075, 0x031B, 0x0002, 0x0041, 0x030C, 0x0002, 0x0061, 0x030C, 0x0002, 0x0049,
+	0x030C, 0x0002, 0x0069, 0x030C, 0x0002, 0x004F, 0x030C, 0x0002, 0x006F, 0x030C, 0x0002, 0x0055,
+	0x030C, 0x0002, 0x0075, 0x030C, 0x0003, 0x0055, 0x0308, 0x0304, 0x0003, 0x0075, 0x0308, 0x0304,
+	0x0003, 0x0055, 0x0308, 0x0301, 0x0003, 0x0075, 0x0308, 0x0301, 0x0003, 0x0055, 0x0308, 0x030C,
+	0x0003, 0x0075, 0x0308, 0x030C, 0x0003, 0x0055, 0x0308, 0x0300, 0x0003, 0x0075, 0x0308, 0x0300,
+	0x0003, 0x0041, 0x0308, 0x0304, 0x0003, 0x0061, 0x0308, 0x0304, 0x0003, 0x0041, 0x0307, 0x0304,
+	0x0003, 0x0061, 0x0307, 0x0304, 0x0002, 0x00C6, 0x0304, 0x0002, 0x00E6, 0x0304, 0x0002, 0x0047,
+	0x030C, 0x0002, 0x0067, 0x030C, 0x0002, 0x004B, 0x030C, 0x0002, 0x006B, 0x030C, 0x0002, 0x004F,
+	0x0328, 0x0002, 0x006F, 0x0328, 0x0003, 0x004F, 0x0328, 0x0304, 0x0003, 0x006F, 0x0328, 0x0304,
+	0x0002, 0x01B7, 0x030C, 0x0002, 0x0292, 0x030C, 0x0002, 0x006A, 0x030C, 0x0002, 0x0047, 0x0301,
+	0x0002, 0x0067, 0x0301, 0x0002, 0x004E, 0x0300, 0x0002, 0x006E, 0x0300, 0x0003, 0x0041, 0x030A,
+	0x0301, 0x0003, 0x0061, 0x030A, 0x0301, 0x0002, 0x00C6, 0x0301, 0x0002, 0x00E6, 0x0301, 0x0002,
+	0x00D8, 0x0301, 0x0002, 0x00F8, 0x0301, 0x0002, 0x0041, 0x030F, 0x0002, 0x0061, 0x030F, 0x0002,
+	0x0041, 0x0311, 0x0002, 0x0061, 0x0311, 0x0002, 0x0045, 0x030F, 0x0002, 0x0065, 0x030F, 0x0002,
+	0x0045, 0x0311, 0x0002, 0x0065, 0x0311, 0x0002, 0x0049, 0x030F, 0x0002, 0x0069, 0x030F, 0x0002,
+	0x0049, 0x0311, 0x0002, 0x0069, 0x0311, 0x0002, 0x004F, 0x030F, 0x0002, 0x006F, 0x030F, 0x0002,
+	0x004F, 0x0311, 0x0002, 0x006F, 0x0311, 0x0002, 0x0052, 0x030F, 0x0002, 0x0072, 0x030F, 0x0002,
+	0x0052, 0x0311, 0x0002, 0x0072, 0x0311, 0x0002, 0x0055, 0x030F, 0x0002, 0x0075, 0x030F, 0x0002,
+	0x0055, 0x0311, 0x0002, 0x0075, 0x0311, 0x0002, 0x0053, 0x0326, 0x0002, 0x0073, 0x0326, 0x0002,
+	0x0054, 0x0326, 0x0002, 0x0074, 0x0326, 0x0002, 0x0048, 0x030C, 0x0002, 0x0068, 0x030C, 0x0002,
+	0x0041, 0x0307, 0x0002, 0x0061, 0x0307, 0x0002, 0x0045, 0x0327, 0x0002, 0x0065, 0x0327, 0x0003,
+	0x004F, 0x0308, 0x0304, 0x0003, 0x006F, 0x0308, 0x0304, 0x0003, 0x004F, 0x0303, 0x0304, 0x0003,
+	0x006F, 0x0303, 0x0304, 0x0002, 0x004F, 0x0307, 0x0002, 0x006F, 0x0307, 0x0003, 0x004F, 0x0307,
+	0x0304, 0x0003, 0x006F, 0x0307, 0x0304, 0x0002, 0x0059, 0x0304, 0x0002, 0x0079, 0x0304, 0x0001,
+	0x0300, 0x0001, 0x0301, 0x0001, 0x0313, 0x0002, 0x0308, 0x0301, 0x0001, 0x02B9, 0x0001, 0x003B,
+	0x0002, 0x00A8, 0x0301, 0x0002, 0x0391, 0x0301, 0x0001, 0x00B7, 0x0002, 0x0395, 0x0301, 0x0002,
+	0x0397, 0x0301, 0x0002, 0x0399, 0x0301, 0x0002, 0x039F, 0x0301, 0x0002, 0x03A5, 0x0301, 0x0002,
+	0x03A9, 0x0301, 0x0003, 0x03B9, 0x0308, 0x0301, 0x0002, 0x0399, 0x0308, 0x0002, 0x03A5, 0x0308,
+	0x0002, 0x03B1, 0x0301, 0x0002, 0x03B5, 0x0301, 0x0002, 0x03B7, 0x0301, 0x0002, 0x03B9, 0x0301,
+	0x0003, 0x03C5, 0x0308, 0x0301, 0x0002, 0x03B9, 0x0308, 0x0002, 0x03C5, 0x0308, 0x0002, 0x03BF,
+	0x0301, 0x0002, 0x03C5, 0x0301, 0x0002, 0x03C9, 0x0301, 0x0002, 0x03D2, 0x0301, 0x0002, 0x03D2,
+	0x0308, 0x0002, 0x0415, 0x0300, 0x0002, 0x0415, 0x0308, 0x0002, 0x0413, 0x0301, 0x0002, 0x0406,
+	0x0308, 0x0002, 0x041A, 0x0301, 0x0002, 0x0418, 0x0300, 0x0002, 0x0423, 0x0306, 0x0002, 0x0418,
+	0x0306, 0x0002, 0x0438, 0x0306, 0x0002, 0x0435, 0x0300, 0x0002, 0x0435, 0x0308, 0x0002, 0x0433,
+	0x0301, 0x0002, 0x0456, 0x0308, 0x0002, 0x043A, 0x0301, 0x0002, 0x0438, 0x0300, 0x0002, 0x0443,
+	0x0306, 0x0002, 0x0474, 0x030F, 0x0002, 0x0475, 0x030F, 0x0002, 0x0416, 0x0306, 0x0002, 0x0436,
+	0x0306, 0x0002, 0x0410, 0x0306, 0x0002, 0x0430, 0x0306, 0x0002, 0x0410, 0x0308, 0x0002, 0x0430,
+	0x0308, 0x0002, 0x0415, 0x0306, 0x0002, 0x0435, 0x0306, 0x0002, 0x04D8, 0x0308, 0x0002, 0x04D9,
+	0x0308, 0x0002, 0x0416, 0x0308, 0x0002, 0x0436, 0x0308, 0x0002, 0x0417, 0x0308, 0x0002, 0x0437,
+	0x0308, 0x0002, 0x0418, 0x0304, 0x0002, 0x0438, 0x0304, 0x0002, 0x0418, 0x0308, 0x0002, 0x0438,
+	0x0308, 0x0002, 0x041E, 0x0308, 0x0002, 0x043E, 0x0308, 0x0002, 0x04E8, 0x0308, 0x0002, 0x04E9,
+	0x0308, 0x0002, 0x042D, 0x0308, 0x0002, 0x044D, 0x0308, 0x0002, 0x0423, 0x0304, 0x0002, 0x0443,
+	0x0304, 0x0002, 0x0423, 0x0308, 0x0002, 0x0443, 0x0308, 0x0002, 0x0423, 0x030B, 0x0002, 0x0443,
+	0x030B, 0x0002, 0x0427, 0x0308, 0x0002, 0x0447, 0x0308, 0x0002, 0x042B, 0x0308, 0x0002, 0x044B,
+	0x0308, 0x0002, 0x0627, 0x0653, 0x0002, 0x0627, 0x0654, 0x0002, 0x0648, 0x0654, 0x0002, 0x0627,
+	0x0655, 0x0002, 0x064A, 0x0654, 0x0002, 0x06D5, 0x0654, 0x0002, 0x06C1, 0x0654, 0x0002, 0x06D2,
+	0x0654, 0x0002, 0x0928, 0x093C, 0x0002, 0x0930, 0x093C, 0x0002, 0x0933, 0x093C, 0x0002, 0x0915,
+	0x093C, 0x0002, 0x0916, 0x093C, 0x0002, 0x0917, 0x093C, 0x0002, 0x091C, 0x093C, 0x0002, 0x0921,
+	0x093C, 0x0002, 0x0922, 0x093C, 0x0002, 0x092B, 0x093C, 0x0002, 0x092F, 0x093C, 0x0002, 0x09C7,
+	0x09BE, 0x0002, 0x09C7, 0x09D7, 0x0002, 0x09A1, 0x09BC, 0x0002, 0x09A2, 0x09BC, 0x0002, 0x09AF,
+	0x09BC, 0x0002, 0x0A32, 0x0A3C, 0x0002, 0x0A38, 0x0A3C, 0x0002, 0x0A16, 0x0A3C, 0x0002, 0x0A17,
+	0x0A3C, 0x0002, 0x0A1C, 0x0A3C, 0x0002, 0x0A2B, 0x0A3C, 0x0002, 0x0B47, 0x0B56, 0x0002, 0x0B47,
+	0x0B3E, 0x0002, 0x0B47, 0x0B57, 0x0002, 0x0B21, 0x0B3C, 0x0002, 0x0B22, 0x0B3C, 0x0002, 0x0B92,
+	0x0BD7, 0x0002, 0x0BC6, 0x0BBE, 0x0002, 0x0BC7, 0x0BBE, 0x0002, 0x0BC6, 0x0BD7, 0x0002, 0x0C46,
+	0x0C56, 0x0002, 0x0CBF, 0x0CD5, 0x0002, 0x0CC6, 0x0CD5, 0x0002, 0x0CC6, 0x0CD6, 0x0002, 0x0CC6,
+	0x0CC2, 0x0003, 0x0CC6, 0x0CC2, 0x0CD5, 0x0002, 0x0D46, 0x0D3E, 0x0002, 0x0D47, 0x0D3E, 0x0002,
+	0x0D46, 0x0D57, 0x0002, 0x0DD9, 0x0DCA, 0x0002, 0x0DD9, 0x0DCF, 0x0003, 0x0DD9, 0x0DCF, 0x0DCA,
+	0x0002, 0x0DD9, 0x0DDF, 0x0002, 0x0F42, 0x0FB7, 0x0002, 0x0F4C, 0x0FB7, 0x0002, 0x0F51, 0x0FB7,
+	0x0002, 0x0F56, 0x0FB7, 0x0002, 0x0F5B, 0x0FB7, 0x0002, 0x0F40, 0x0FB5, 0x0002, 0x0F71, 0x0F72,
+	0x0002, 0x0F71, 0x0F74, 0x0002, 0x0FB2, 0x0F80, 0x0002, 0x0FB3, 0x0F80, 0x0002, 0x0F71, 0x0F80,
+	0x0002, 0x0F92, 0x0FB7, 0x0002, 0x0F9C, 0x0FB7, 0x0002, 0x0FA1, 0x0FB7, 0x0002, 0x0FA6, 0x0FB7,
+	0x0002, 0x0FAB, 0x0FB7, 0x0002, 0x0F90, 0x0FB5, 0x0002, 0x1025, 0x102E, 0x0002, 0x1B05, 0x1B35,
+	0x0002, 0x1B07, 0x1B35, 0x0002, 0x1B09, 0x1B35, 0x0002, 0x1B0B, 0x1B35, 0x0002, 0x1B0D, 0x1B35,
+	0x0002, 0x1B11, 0x1B35, 0x0002, 0x1B3A, 0x1B35, 0x0002, 0x1B3C, 0x1B35, 0x0002, 0x1B3E, 0x1B35,
+	0x0002, 0x1B3F, 0x1B35, 0x0002, 0x1B42, 0x1B35, 0x0002, 0x0041, 0x0325, 0x0002, 0x0061, 0x0325,
+	0x0002, 0x0042, 0x0307, 0x0002, 0x0062, 0x0307, 0x0002, 0x0042, 0x0323, 0x0002, 0x0062, 0x0323,
+	0x0002, 0x0042, 0x0331, 0x0002, 0x0062, 0x0331, 0x0003, 0x0043, 0x0327, 0x0301, 0x0003, 0x0063,
+	0x0327, 0x0301, 0x0002, 0x0044, 0x0307, 0x0002, 0x0064, 0x0307, 0x0002, 0x0044, 0x0323, 0x0002,
+	0x0064, 0x0323, 0x0002, 0x0044, 0x0331, 0x0002, 0x0064, 0x0331, 0x0002, 0x0044, 0x0327, 0x0002,
+	0x0064, 0x0327, 0x0002, 0x0044, 0x032D, 0x0002, 0x0064, 0x032D, 0x0003, 0x0045, 0x0304, 0x0300,
+	0x0003, 0x0065, 0x0304, 0x0300, 0x0003, 0x0045, 0x0304, 0x0301, 0x0003, 0x0065, 0x0304, 0x0301,
+	0x0002, 0x0045, 0x032D, 0x0002, 0x0065, 0x032D, 0x0002, 0x0045, 0x0330, 0x0002, 0x0065, 0x0330,
+	0x0003, 0x0045, 0x0327, 0x0306, 0x0003, 0x0065, 0x0327, 0x0306, 0x0002, 0x0046, 0x0307, 0x0002,
+	0x0066, 0x0307, 0x0002, 0x0047, 0x0304, 0x0002, 0x0067, 0x0304, 0x0002, 0x0048, 0x0307, 0x0002,
+	0x0068, 0x0307, 0x0002, 0x0048, 0x0323, 0x0002, 0x0068, 0x0323, 0x0002, 0x0048, 0x0308, 0x0002,
+	0x0068, 0x0308, 0x0002, 0x0048, 0x0327, 0x0002, 0x0068, 0x0327, 0x0002, 0x0048, 0x032E, 0x0002,
+	0x0068, 0x032E, 0x0002, 0x0049, 0x0330, 0x0002, 0x0069, 0x0330, 0x0003, 0x0049, 0x0308, 0x0301,
+	0x0003, 0x0069, 0x0308, 0x0301, 0x0002, 0x004B, 0x0301, 0x0002, 0x006B, 0x0301, 0x0002, 0x004B,
+	0x0323, 0x0002, 0x006B, 0x0323, 0x0002, 0x004B, 0x0331, 0x0002, 0x006B, 0x0331, 0x0002, 0x004C,
+	0x0323, 0x0002, 0x006C, 0x0323, 0x0003, 0x004C, 0x0323, 0x0304, 0x0003, 0x006C, 0x0323, 0x0304,
+	0x0002, 0x004C, 0x0331, 0x0002, 0x006C, 0x0331, 0x0002, 0x004C, 0x032D, 0x0002, 0x006C, 0x032D,
+	0x0002, 0x004D, 0x0301, 0x0002, 0x006D, 0x0301, 0x0002, 0x004D, 0x0307, 0x0002, 0x006D, 0x0307,
+	0x0002, 0x004D, 0x0323, 0x0002, 0x006D, 0x0323, 0x0002, 0x004E, 0x0307, 0x0002, 0x006E, 0x0307,
+	0x0002, 0x004E, 0x0323, 0x0002, 0x006E, 0x0323, 0x0002, 0x004E, 0x0331, 0x0002, 0x006E, 0x0331,
+	0x0002, 0x004E, 0x032D, 0x0002, 0x006E, 0x032D, 0x0003, 0x004F, 0x0303, 0x0301, 0x0003, 0x006F,
+	0x0303, 0x0301, 0x0003, 0x004F, 0x0303, 0x0308, 0x0003, 0x006F, 0x0303, 0x0308, 0x0003, 0x004F,
+	0x0304, 0x0300, 0x0003, 0x006F, 0x0304, 0x0300, 0x0003, 0x004F, 0x0304, 0x0301, 0x0003, 0x006F,
+	0x0304, 0x0301, 0x0002, 0x0050, 0x0301, 0x0002, 0x0070, 0x0301, 0x0002, 0x0050, 0x0307, 0x0002,
+	0x0070, 0x0307, 0x0002, 0x0052, 0x0307, 0x0002, 0x0072, 0x0307, 0x0002, 0x0052, 0x0323, 0x0002,
+	0x0072, 0x0323, 0x0003, 0x0052, 0x0323, 0x0304, 0x0003, 0x0072, 0x0323, 0x0304, 0x0002, 0x0052,
+	0x0331, 0x0002, 0x0072, 0x0331, 0x0002, 0x0053, 0x0307, 0x0002, 0x0073, 0x0307, 0x0002, 0x0053,
+	0x0323, 0x0002, 0x0073, 0x0323, 0x0003, 0x0053, 0x0301, 0x0307, 0x0003, 0x0073, 0x0301, 0x0307,
+	0x0003, 0x0053, 0x030C, 0x0307, 0x0003, 0x0073, 0x030C, 0x0307, 0x0003, 0x0053, 0x0323, 0x0307,
+	0x0003, 0x0073, 0x0323, 0x0307, 0x0002, 0x0054, 0x0307, 0x0002, 0x0074, 0x0307, 0x0002, 0x0054,
+	0x0323, 0x0002, 0x0074, 0x0323, 0x0002, 0x0054, 0x0331, 0x0002, 0x0074, 0x0331, 0x0002, 0x0054,
+	0x032D, 0x0002, 0x0074, 0x032D, 0x0002, 0x0055, 0x0324, 0x0002, 0x0075, 0x0324, 0x0002, 0x0055,
+	0x0330, 0x0002, 0x0075, 0x0330, 0x0002, 0x0055, 0x032D, 0x0002, 0x0075, 0x032D, 0x0003, 0x0055,
+	0x0303, 0x0301, 0x0003, 0x0075, 0x0303, 0x0301, 0x0003, 0x0055, 0x0304, 0x0308, 0x0003, 0x0075,
+	0x0304, 0x0308, 0x0002, 0x0056, 0x0303, 0x0002, 0x0076, 0x0303, 0x0002, 0x0056, 0x0323, 0x0002,
+	0x0076, 0x0323, 0x0002, 0x0057, 0x0300, 0x0002, 0x0077, 0x0300, 0x0002, 0x0057, 0x0301, 0x0002,
+	0x0077, 0x0301, 0x0002, 0x0057, 0x0308, 0x0002, 0x0077, 0x0308, 0x0002, 0x0057, 0x0307, 0x0002,
+	0x0077, 0x0307, 0x0002, 0x0057, 0x0323, 0x0002, 0x0077, 0x0323, 0x0002, 0x0058, 0x0307, 0x0002,
+	0x0078, 0x0307, 0x0002, 0x0058, 0x0308, 0x0002, 0x0078, 0x0308, 0x0002, 0x0059, 0x0307, 0x0002,
+	0x0079, 0x0307, 0x0002, 0x005A, 0x0302, 0x0002, 0x007A, 0x0302, 0x0002, 0x005A, 0x0323, 0x0002,
+	0x007A, 0x0323, 0x0002, 0x005A, 0x0331, 0x0002, 0x007A, 0x0331, 0x0002, 0x0068, 0x0331, 0x0002,
+	0x0074, 0x0308, 0x0002, 0x0077, 0x030A, 0x0002, 0x0079, 0x030A, 0x0002, 0x017F, 0x0307, 0x0002,
+	0x0041, 0x0323, 0x0002, 0x0061, 0x0323, 0x0002, 0x0041, 0x0309, 0x0002, 0x0061, 0x0309, 0x0003,
+	0x0041, 0x0302, 0x0301, 0x0003, 0x0061, 0x0302, 0x0301, 0x0003, 0x0041, 0x0302, 0x0300, 0x0003,
+	0x0061, 0x0302, 0x0300, 0x0003, 0x0041, 0x0302, 0x0309, 0x0003, 0x0061, 0x0302, 0x0309, 0x0003,
+	0x0041, 0x0302, 0x0303, 0x0003, 0x0061, 0x0302, 0x0303, 0x0003, 0x0041, 0x0323, 0x0302, 0x0003,
+	0x0061, 0x0323, 0x0302, 0x0003, 0x0041, 0x0306, 0x0301, 0x0003, 0x0061, 0x0306, 0x0301, 0x0003,
+	0x0041, 0x0306, 0x0300, 0x0003, 0x0061, 0x0306, 0x0300, 0x0003, 0x0041, 0x0306, 0x0309, 0x0003,
+	0x0061, 0x0306, 0x0309, 0x0003, 0x0041, 0x0306, 0x0303, 0x0003, 0x0061, 0x0306, 0x0303, 0x0003,
+	0x0041, 0x0323, 0x0306, 0x0003, 0x0061, 0x0323, 0x0306, 0x0002, 0x0045, 0x0323, 0x0002, 0x0065,
+	0x0323, 0x0002, 0x0045, 0x0309, 0x0002, 0x0065, 0x0309, 0x0002, 0x0045, 0x0303, 0x0002, 0x0065,
+	0x0303, 0x0003, 0x0045, 0x0302, 0x0301, 0x0003, 0x0065, 0x0302, 0x0301, 0x0003, 0x0045, 0x0302,
+	0x0300, 0x0003, 0x0065, 0x0302, 0x0300, 0x0003, 0x0045, 0x0302, 0x0309, 0x0003, 0x0065, 0x0302,
+	0x0309, 0x0003, 0x0045, 0x0302, 0x0303, 0x0003, 0x0065, 0x0302, 0x0303, 0x0003, 0x0045, 0x0323,
+	0x0302, 0x0003, 0x0065, 0x0323, 0x0302, 0x0002, 0x0049, 0x0309, 0x0002, 0x0069, 0x0309, 0x0002,
+	0x0049, 0x0323, 0x0002, 0x0069, 0x0323, 0x0002, 0x004F, 0x0323, 0x0002, 0x006F, 0x0323, 0x0002,
+	0x004F, 0x0309, 0x0002, 0x006F, 0x0309, 0x0003, 0x004F, 0x0302, 0x0301, 0x0003, 0x006F, 0x0302,
+	0x0301, 0x0003, 0x004F, 0x0302, 0x0300, 0x0003, 0x006F, 0x0302, 0x0300, 0x0003, 0x004F, 0x0302,
+	0x0309, 0x0003, 0x006F, 0x0302, 0x0309, 0x0003, 0x004F, 0x0302, 0x0303, 0x0003, 0x006F, 0x0302,
+	0x0303, 0x0003, 0x004F, 0x0323, 0x0302, 0x0003, 0x006F, 0x0323, 0x0302, 0x0003, 0x004F, 0x031B,
+	0x0301, 0x0003, 0x006F, 0x031B, 0x0301, 0x0003, 0x004F, 0x031B, 0x0300, 0x0003, 0x006F, 0x031B,
+	0x0300, 0x0003, 0x004F, 0x031B, 0x0309, 0x0003, 0x006F, 0x031B, 0x0309, 0x0003, 0x004F, 0x031B,
+	0x0303, 0x0003, 0x006F, 0x031B, 0x0303, 0x0003, 0x004F, 0x031B, 0x0323, 0x0003, 0x006F, 0x031B,
+	0x0323, 0x0002, 0x0055, 0x0323, 0x0002, 0x0075, 0x0323, 0x0002, 0x0055, 0x0309, 0x0002, 0x0075,
+	0x0309, 0x0003, 0x0055, 0x031B, 0x0301, 0x0003, 0x0075, 0x031B, 0x0301, 0x0003, 0x0055, 0x031B,
+	0x0300, 0x0003, 0x0075, 0x031B, 0x0300, 0x0003, 0x0055, 0x031B, 0x0309, 0x0003, 0x0075, 0x031B,
+	0x0309, 0x0003, 0x0055, 0x031B, 0x0303, 0x0003, 0x0075, 0x031B, 0x0303, 0x0003, 0x0055, 0x031B,
+	0x0323, 0x0003, 0x0075, 0x031B, 0x0323, 0x0002, 0x0059, 0x0300, 0x0002, 0x0079, 0x0300, 0x0002,
+	0x0059, 0x0323, 0x0002, 0x0079, 0x0323, 0x0002, 0x0059, 0x0309, 0x0002, 0x0079, 0x0309, 0x0002,
+	0x0059, 0x0303, 0x0002, 0x0079, 0x0303, 0x0002, 0x03B1, 0x0313, 0x0002, 0x03B1, 0x0314, 0x0003,
+	0x03B1, 0x0313, 0x0300, 0x0003, 0x03B1, 0x0314, 0x0300, 0x0003, 0x03B1, 0x0313, 0x0301, 0x0003,
+	0x03B1, 0x0314, 0x0301, 0x0003, 0x03B1, 0x0313, 0x0342, 0x0003, 0x03B1, 0x0314, 0x0342, 0x0002,
+	0x0391, 0x0313, 0x0002, 0x0391, 0x0314, 0x0003, 0x0391, 0x0313, 0x0300, 0x0003, 0x0391, 0x0314,
+	0x0300, 0x0003, 0x0391, 0x0313, 0x0301, 0x0003, 0x0391, 0x0314, 0x0301, 0x0003, 0x0391, 0x0313,
+	0x0342, 0x0003, 0x0391, 0x0314, 0x0342, 0x0002, 0x03B5, 0x0313, 0x0002, 0x03B5, 0x0314, 0x0003,
+	0x03B5, 0x0313, 0x0300, 0x0003, 0x03B5, 0x0314, 0x0300, 0x0003, 0x03B5, 0x0313, 0x0301, 0x0003,
+	0x03B5, 0x0314, 0x0301, 0x0002, 0x0395, 0x0313, 0x0002, 0x0395, 0x0314, 0x0003, 0x0395, 0x0313,
+	0x0300, 0x0003, 0x0395, 0x0314, 0x0300, 0x0003, 0x0395, 0x0313, 0x0301, 0x0003, 0x0395, 0x0314,
+	0x0301, 0x0002, 0x03B7, 0x0313, 0x0002, 0x03B7, 0x0314, 0x0003, 0x03B7, 0x0313, 0x0300, 0x0003,
+	0x03B7, 0x0314, 0x0300, 0x0003, 0x03B7, 0x0313, 0x0301, 0x0003, 0x03B7, 0x0314, 0x0301, 0x0003,
+	0x03B7, 0x0313, 0x0342, 0x0003, 0x03B7, 0x0314, 0x0342, 0x0002, 0x0397, 0x0313, 0x0002, 0x0397,
+	0x0314, 0x0003, 0x0397, 0x0313, 0x0300, 0x0003, 0x0397, 0x0314, 0x0300, 0x0003, 0x0397, 0x0313,
+	0x0301, 0x0003, 0x0397, 0x0314, 0x0301, 0x0003, 0x0397, 0x0313, 0x0342, 0x0003, 0x0397, 0x0314,
+	0x0342, 0x0002, 0x03B9, 0x0313, 0x0002, 0x03B9, 0x0314, 0x0003, 0x03B9, 0x0313, 0x0300, 0x0003,
+	0x03B9, 0x0314, 0x0300, 0x0003, 0x03B9, 0x0313, 0x0301, 0x0003, 0x03B9, 0x0314, 0x0301, 0x0003,
+	0x03B9, 0x0313, 0x0342, 0x0003, 0x03B9, 0x0314, 0x0342, 0x0002, 0x0399, 0x0313, 0x0002, 0x0399,
+	0x0314, 0x0003, 0x0399, 0x0313, 0x0300, 0x0003, 0x0399, 0x0314, 0x0300, 0x0003, 0x0399, 0x0313,
+	0x0301, 0x0003, 0x0399, 0x0314, 0x0301, 0x0003, 0x0399, 0x0313, 0x0342, 0x0003, 0x0399, 0x0314,
+	0x0342, 0x0002, 0x03BF, 0x0313, 0x0002, 0x03BF, 0x0314, 0x0003, 0x03BF, 0x0313, 0x0300, 0x0003,
+	0x03BF, 0x0314, 0x0300, 0x0003, 0x03BF, 0x0313, 0x0301, 0x0003, 0x03BF, 0x0314, 0x0301, 0x0002,
+	0x039F, 0x0313, 0x0002, 0x039F, 0x0314, 0x0003, 0x039F, 0x0313, 0x0300, 0x0003, 0x039F, 0x0314,
+	0x0300, 0x0003, 0x039F, 0x0313, 0x0301, 0x0003, 0x039F, 0x0314, 0x0301, 0x0002, 0x03C5, 0x0313,
+	0x0002, 0x03C5, 0x0314, 0x0003, 0x03C5, 0x0313, 0x0300, 0x0003, 0x03C5, 0x0314, 0x0300, 0x0003,
+	0x03C5, 0x0313, 0x0301, 0x0003, 0x03C5, 0x0314, 0x0301, 0x0003, 0x03C5, 0x0313, 0x0342, 0x0003,
+	0x03C5, 0x0314, 0x0342, 0x0002, 0x03A5, 0x0314, 0x0003, 0x03A5, 0x0314, 0x0300, 0x0003, 0x03A5,
+	0x0314, 0x0301, 0x0003, 0x03A5, 0x0314, 0x0342, 0x0002, 0x03C9, 0x0313, 0x0002, 0x03C9, 0x0314,
+	0x0003, 0x03C9, 0x0313, 0x0300, 0x0003, 0x03C9, 0x0314, 0x0300, 0x0003, 0x03C9, 0x0313, 0x0301,
+	0x0003, 0x03C9, 0x0314, 0x0301, 0x0003, 0x03C9, 0x0313, 0x0342, 0x0003, 0x03C9, 0x0314, 0x0342,
+	0x0002, 0x03A9, 0x0313, 0x0002, 0x03A9, 0x0314, 0x0003, 0x03A9, 0x0313, 0x0300, 0x0003, 0x03A9,
+	0x0314, 0x0300, 0x0003, 0x03A9, 0x0313, 0x0301, 0x0003, 0x03A9, 0x0314, 0x0301, 0x0003, 0x03A9,
+	0x0313, 0x0342, 0x0003, 0x03A9, 0x0314, 0x0342, 0x0002, 0x03B1, 0x0300, 0x0002, 0x03B5, 0x0300,
+	0x0002, 0x03B7, 0x0300, 0x0002, 0x03B9, 0x0300, 0x0002, 0x03BF, 0x0300, 0x0002, 0x03C5, 0x0300,
+	0x0002, 0x03C9, 0x0300, 0x0003, 0x03B1, 0x0313, 0x0345, 0x0003, 0x03B1, 0x0314, 0x0345, 0x0004,
+	0x03B1, 0x0313, 0x0300, 0x0345, 0x0004, 0x03B1, 0x0314, 0x0300, 0x0345, 0x0004, 0x03B1, 0x0313,
+	0x0301, 0x0345, 0x0004, 0x03B1, 0x0314, 0x0301, 0x0345, 0x0004, 0x03B1, 0x0313, 0x0342, 0x0345,
+	0x0004, 0x03B1, 0x0314, 0x0342, 0x0345, 0x0003, 0x0391, 0x0313, 0x0345, 0x0003, 0x0391, 0x0314,
+	0x0345, 0x0004, 0x0391, 0x0313, 0x0300, 0x0345, 0x0004, 0x0391, 0x0314, 0x0300, 0x0345, 0x0004,
+	0x0391, 0x0313, 0x0301, 0x0345, 0x0004, 0x0391, 0x0314, 0x0301, 0x0345, 0x0004, 0x0391, 0x0313,
+	0x0342, 0x0345, 0x0004, 0x0391, 0x0314, 0x0342, 0x0345, 0x0003, 0x03B7, 0x0313, 0x0345, 0x0003,
+	0x03B7, 0x0314, 0x0345, 0x0004, 0x03B7, 0x0313, 0x0300, 0x0345, 0x0004, 0x03B7, 0x0314, 0x0300,
+	0x0345, 0x0004, 0x03B7, 0x0313, 0x0301, 0x0345, 0x0004, 0x03B7, 0x0314, 0x0301, 0x0345, 0x0004,
+	0x03B7, 0x0313, 0x0342, 0x0345, 0x0004, 0x03B7, 0x0314, 0x0342, 0x0345, 0x0003, 0x0397, 0x0313,
+	0x0345, 0x0003, 0x0397, 0x0314, 0x0345, 0x0004, 0x0397, 0x0313, 0x0300, 0x0345, 0x0004, 0x0397,
+	0x0314, 0x0300, 0x0345, 0x0004, 0x0397, 0x0313, 0x0301, 0x0345, 0x0004, 0x0397, 0x0314, 0x0301,
+	0x0345, 0x0004, 0x0397, 0x0313, 0x0342, 0x0345, 0x0004, 0x0397, 0x0314, 0x0342, 0x0345, 0x0003,
+	0x03C9, 0x0313, 0x0345, 0x0003, 0x03C9, 0x0314, 0x0345, 0x0004, 0x03C9, 0x0313, 0x0300, 0x0345,
+	0x0004, 0x03C9, 0x0314, 0x0300, 0x0345, 0x0004, 0x03C9, 0x0313, 0x0301, 0x0345, 0x0004, 0x03C9,
+	0x0314, 0x0301, 0x0345, 0x0004, 0x03C9, 0x0313, 0x0342, 0x0345, 0x0004, 0x03C9, 0x0314, 0x0342,
+	0x0345, 0x0003, 0x03A9, 0x0313, 0x0345, 0x0003, 0x03A9, 0x0314, 0x0345, 0x0004, 0x03A9, 0x0313,
+	0x0300, 0x0345, 0x0004, 0x03A9, 0x0314, 0x0300, 0x0345, 0x0004, 0x03A9, 0x0313, 0x0301, 0x0345,
+	0x0004, 0x03A9, 0x0314, 0x0301, 0x0345, 0x0004, 0x03A9, 0x0313, 0x0342, 0x0345, 0x0004, 0x03A9,
+	0x0314, 0x0342, 0x0345, 0x0002, 0x03B1, 0x0306, 0x0002, 0x03B1, 0x0304, 0x0003, 0x03B1, 0x0300,
+	0x0345, 0x0002, 0x03B1, 0x0345, 0x0003, 0x03B1, 0x0301, 0x0345, 0x0002, 0x03B1, 0x0342, 0x0003,
+	0x03B1, 0x0342, 0x0345, 0x0002, 0x0391, 0x0306, 0x0002, 0x0391, 0x0304, 0x0002, 0x0391, 0x0300,
+	0x0002, 0x0391, 0x0345, 0x0001, 0x03B9, 0x0002, 0x00A8, 0x0342, 0x0003, 0x03B7, 0x0300, 0x0345,
+	0x0002, 0x03B7, 0x0345, 0x0003, 0x03B7, 0x0301, 0x0345, 0x0002, 0x03B7, 0x0342, 0x0003, 0x03B7,
+	0x0342, 0x0345, 0x0002, 0x0395, 0x0300, 0x0002, 0x0397, 0x0300, 0x0002, 0x0397, 0x0345, 0x0002,
+	0x1FBF, 0x0300, 0x0002, 0x1FBF, 0x0301, 0x0002, 0x1FBF, 0x0342, 0x0002, 0x03B9, 0x0306, 0x0002,
+	0x03B9, 0x0304, 0x0003, 0x03B9, 0x0308, 0x0300, 0x0002, 0x03B9, 0x0342, 0x0003, 0x03B9, 0x0308,
+	0x0342, 0x0002, 0x0399, 0x0306, 0x0002, 0x0399, 0x0304, 0x0002, 0x0399, 0x0300, 0x0002, 0x1FFE,
+	0x0300, 0x0002, 0x1FFE, 0x0301, 0x0002, 0x1FFE, 0x0342, 0x0002, 0x03C5, 0x0306, 0x0002, 0x03C5,
+	0x0304, 0x0003, 0x03C5, 0x0308, 0x0300, 0x0002, 0x03C1, 0x0313, 0x0002, 0x03C1, 0x0314, 0x0002,
+	0x03C5, 0x0342, 0x0003, 0x03C5, 0x0308, 0x0342, 0x0002, 0x03A5, 0x0306, 0x0002, 0x03A5, 0x0304,
+	0x0002, 0x03A5, 0x0300, 0x0002, 0x03A1, 0x0314, 0x0002, 0x00A8, 0x0300, 0x0001, 0x0060, 0x0003,
+	0x03C9, 0x0300, 0x0345, 0x0002, 0x03C9, 0x0345, 0x0003, 0x03C9, 0x0301, 0x0345, 0x0002, 0x03C9,
+	0x0342, 0x0003, 0x03C9, 0x0342, 0x0345, 0x0002, 0x039F, 0x0300, 0x0002, 0x03A9, 0x0300, 0x0002,
+	0x03A9, 0x0345, 0x0001, 0x00B4, 0x0002, 0x304B, 0x3099, 0x0002, 0x304D, 0x3099, 0x0002, 0x304F,
+	0x3099, 0x0002, 0x3051, 0x3099, 0x0002, 0x3053, 0x3099, 0x0002, 0x3055, 0x3099, 0x0002, 0x3057,
+	0x3099, 0x0002, 0x3059, 0x3099, 0x0002, 0x305B, 0x3099, 0x0002, 0x305D, 0x3099, 0x0002, 0x305F,
+	0x3099, 0x0002, 0x3061, 0x3099, 0x0002, 0x3064, 0x3099, 0x0002, 0x3066, 0x3099, 0x0002, 0x3068,
+	0x3099, 0x0002, 0x306F, 0x3099, 0x0002, 0x306F, 0x309A, 0x0002, 0x3072, 0x3099, 0x0002, 0x3072,
+	0x309A, 0x0002, 0x3075, 0x3099, 0x0002, 0x3075, 0x309A, 0x0002, 0x3078, 0x3099, 0x0002, 0x3078,
+	0x309A, 0x0002, 0x307B, 0x3099, 0x0002, 0x307B, 0x309A, 0x0002, 0x3046, 0x3099, 0x0002, 0x309D,
+	0x3099, 0x0002, 0x30AB, 0x3099, 0x0002, 0x30AD, 0x3099, 0x0002, 0x30AF, 0x3099, 0x0002, 0x30B1,
+	0x3099, 0x0002, 0x30B3, 0x3099, 0x0002, 0x30B5, 0x3099, 0x0002, 0x30B7, 0x3099, 0x0002, 0x30B9,
+	0x3099, 0x0002, 0x30BB, 0x3099, 0x0002, 0x30BD, 0x3099, 0x0002, 0x30BF, 0x3099, 0x0002, 0x30C1,
+	0x3099, 0x0002, 0x30C4, 0x3099, 0x0002, 0x30C6, 0x3099, 0x0002, 0x30C8, 0x3099, 0x0002, 0x30CF,
+	0x3099, 0x0002, 0x30CF, 0x309A, 0x0002, 0x30D2, 0x3099, 0x0002, 0x30D2, 0x309A, 0x0002, 0x30D5,
+	0x3099, 0x0002, 0x30D5, 0x309A, 0x0002, 0x30D8, 0x3099, 0x0002, 0x30D8, 0x309A, 0x0002, 0x30DB,
+	0x3099, 0x0002, 0x30DB, 0x309A, 0x0002, 0x30A6, 0x3099, 0x0002, 0x30EF, 0x3099, 0x0002, 0x30F0,
+	0x3099, 0x0002, 0x30F1, 0x3099, 0x0002, 0x30F2, 0x3099, 0x0002, 0x30FD, 0x3099, 0x0002, 0x05D9,
+	0x05B4, 0x0002, 0x05F2, 0x05B7, 0x0002, 0x05E9, 0x05C1, 0x0002, 0x05E9, 0x05C2, 0x0003, 0x05E9,
+	0x05BC, 0x05C1, 0x0003, 0x05E9, 0x05BC, 0x05C2, 0x0002, 0x05D0, 0x05B7, 0x0002, 0x05D0, 0x05B8,
+	0x0002, 0x05D0, 0x05BC, 0x0002, 0x05D1, 0x05BC, 0x0002, 0x05D2, 0x05BC, 0x0002, 0x05D3, 0x05BC,
+	0x0002, 0x05D4, 0x05BC, 0x0002, 0x05D5, 0x05BC, 0x0002, 0x05D6, 0x05BC, 0x0002, 0x05D8, 0x05BC,
+	0x0002, 0x05D9, 0x05BC, 0x0002, 0x05DA, 0x05BC, 0x0002, 0x05DB, 0x05BC, 0x0002, 0x05DC, 0x05BC,
+	0x0002, 0x05DE, 0x05BC, 0x0002, 0x05E0, 0x05BC, 0x0002, 0x05E1, 0x05BC, 0x0002, 0x05E3, 0x05BC,
+	0x0002, 0x05E4, 0x05BC, 0x0002, 0x05E6, 0x05BC, 0x0002, 0x05E7, 0x05BC, 0x0002, 0x05E8, 0x05BC,
+	0x0002, 0x05E9, 0x05BC, 0x0002, 0x05EA, 0x05BC, 0x0002, 0x05D5, 0x05B9, 0x0002, 0x05D1, 0x05BF,
+	0x0002, 0x05DB, 0x05BF, 0x0002, 0x05E4, 0x05BF,
+};
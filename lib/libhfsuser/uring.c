@@ -0,0 +1,288 @@
+/*
+ * libhfsuser - Userspace support library for NetBSD's libhfs
+ * This file is part of the hfsfuse project.
+ */
+
+#include "uring.h"
+
+#include <errno.h>
+
+#if HAVE_IO_URING
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+// reads in flight at once for each thread
+#define HFS_URING_ENTRIES 64
+// longer reads are split, as an sqe's length is only 32 bits
+#define HFS_URING_MAX_LEN (1 << 30)
+
+struct hfs_uring {
+	int fd;
+	unsigned entries;
+	unsigned generation;
+	bool broken;
+	unsigned* sq_head,* sq_tail,* sq_mask,* sq_array;
+	unsigned* cq_head,* cq_tail,* cq_mask;
+	struct io_uring_sqe* sqes;
+	struct io_uring_cqe* cqes;
+	void* sq_ring,* cq_ring;
+	size_t sq_ring_size, cq_ring_size;
+};
+
+// what's left of each read in the current batch, advanced after short reads
+struct hfs_uring_read {
+	char* buf;
+	uint64_t length, offset;
+};
+
+static pthread_key_t hfs_uring_key;
+// stored in the key of a thread whose ring couldn't be set up, so it isn't retried on every read
+static struct hfs_uring hfs_uring_failed;
+static pthread_once_t hfs_uring_once = PTHREAD_ONCE_INIT;
+static int hfs_uring_key_err;
+// set when setting up a ring failed in a way retrying won't fix, e.g. the kernel lacks io_uring or it's disallowed
+static int hfs_uring_unsupported;
+// bumped in the child after a fork, which must not share its parent's rings, e.g. when FUSE daemonizes
+static unsigned hfs_uring_generation;
+
+static void hfs_uring_destroy(void* data) {
+	struct hfs_uring* ring = data;
+	if(!ring || ring == &hfs_uring_failed)
+		return;
+	if(ring->sqes)
+		munmap(ring->sqes,ring->entries * sizeof(struct io_uring_sqe));
+	if(ring->cq_ring && ring->cq_ring != ring->sq_ring)
+		munmap(ring->cq_ring,ring->cq_ring_size);
+	if(ring->sq_ring)
+		munmap(ring->sq_ring,ring->sq_ring_size);
+	close(ring->fd);
+	free(ring);
+}
+
+static void hfs_uring_atfork_child(void) {
+	hfs_uring_generation++;
+}
+
+static void hfs_uring_key_create(void) {
+	if(!(hfs_uring_key_err = pthread_key_create(&hfs_uring_key,hfs_uring_destroy)))
+		hfs_uring_key_err = pthread_atfork(NULL,NULL,hfs_uring_atfork_child);
+}
+
+static void* hfs_uring_mmap(int fd, size_t size, off_t offset) {
+	void* p = mmap(NULL,size,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_POPULATE,fd,offset);
+	return p == MAP_FAILED ? NULL : p;
+}
+
+static struct hfs_uring* hfs_uring_create(void) {
+	struct io_uring_params p;
+	memset(&p,0,sizeof(p));
+	int fd = syscall(__NR_io_uring_setup,HFS_URING_ENTRIES,&p);
+	if(fd < 0)
+		return NULL;
+
+	// IORING_OP_READ arrived in the same kernel as this feature flag
+	if(!(p.features & IORING_FEAT_RW_CUR_POS)) {
+		close(fd);
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	struct hfs_uring* ring = calloc(1,sizeof(*ring));
+	if(!ring) {
+		close(fd);
+		errno = ENOMEM;
+		return NULL;
+	}
+	ring->fd = fd;
+	ring->entries = p.sq_entries;
+	ring->generation = hfs_uring_generation;
+	ring->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	ring->cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if(p.features & IORING_FEAT_SINGLE_MMAP) {
+		if(ring->sq_ring_size < ring->cq_ring_size)
+			ring->sq_ring_size = ring->cq_ring_size;
+		ring->cq_ring_size = ring->sq_ring_size;
+	}
+
+	if(!(ring->sq_ring = hfs_uring_mmap(fd,ring->sq_ring_size,IORING_OFF_SQ_RING)))
+		goto error;
+	if(p.features & IORING_FEAT_SINGLE_MMAP)
+		ring->cq_ring = ring->sq_ring;
+	else if(!(ring->cq_ring = hfs_uring_mmap(fd,ring->cq_ring_size,IORING_OFF_CQ_RING)))
+		goto error;
+	if(!(ring->sqes = hfs_uring_mmap(fd,p.sq_entries * sizeof(struct io_uring_sqe),IORING_OFF_SQES)))
+		goto error;
+
+	ring->sq_head = (unsigned*)((char*)ring->sq_ring + p.sq_off.head);
+	ring->sq_tail = (unsigned*)((char*)ring->sq_ring + p.sq_off.tail);
+	ring->sq_mask = (unsigned*)((char*)ring->sq_ring + p.sq_off.ring_mask);
+	ring->sq_array = (unsigned*)((char*)ring->sq_ring + p.sq_off.array);
+	ring->cq_head = (unsigned*)((char*)ring->cq_ring + p.cq_off.head);
+	ring->cq_tail = (unsigned*)((char*)ring->cq_ring + p.cq_off.tail);
+	ring->cq_mask = (unsigned*)((char*)ring->cq_ring + p.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe*)((char*)ring->cq_ring + p.cq_off.cqes);
+	return ring;
+
+error:;
+	int err = errno;
+	hfs_uring_destroy(ring);
+	errno = err;
+	return NULL;
+}
+
+static struct hfs_uring* hfs_uring_get(void) {
+	if(pthread_once(&hfs_uring_once,hfs_uring_key_create) || hfs_uring_key_err || __atomic_load_n(&hfs_uring_unsupported,__ATOMIC_RELAXED))
+		return NULL;
+
+	struct hfs_uring* ring = pthread_getspecific(hfs_uring_key);
+	if(ring == &hfs_uring_failed)
+		return NULL;
+	if(ring && ring->generation == hfs_uring_generation)
+		return ring;
+	if(ring) {
+		pthread_setspecific(hfs_uring_key,NULL);
+		hfs_uring_destroy(ring);
+	}
+
+	if(!(ring = hfs_uring_create())) {
+		if(errno == ENOSYS || errno == EPERM || errno == EACCES)
+			__atomic_store_n(&hfs_uring_unsupported,1,__ATOMIC_RELAXED);
+		else pthread_setspecific(hfs_uring_key,&hfs_uring_failed);
+		return NULL;
+	}
+	if(pthread_setspecific(hfs_uring_key,ring)) {
+		hfs_uring_destroy(ring);
+		return NULL;
+	}
+	return ring;
+}
+
+bool hfs_uring_available(void) {
+	return hfs_uring_get() != NULL;
+}
+
+static int hfs_uring_enter(struct hfs_uring* ring, unsigned submit, unsigned wait) {
+	int ret;
+	while((ret = syscall(__NR_io_uring_enter,ring->fd,submit,wait,wait ? IORING_ENTER_GETEVENTS : 0,NULL,0)) < 0)
+		if(errno != EINTR && errno != EAGAIN && errno != EBUSY)
+			return -errno;
+	return ret;
+}
+
+// submits every unfinished read and waits for all of them to complete
+// on failure nothing is left queued or in flight, unless the ring is marked broken
+static int hfs_uring_submit(struct hfs_uring* ring, int fd, struct hfs_uring_read* reads, unsigned count) {
+	unsigned start = *ring->sq_tail, tail = start, mask = *ring->sq_mask, queued = 0;
+	for(unsigned i = 0; i < count; i++) {
+		if(!reads[i].length)
+			continue;
+		unsigned index = tail & mask;
+		struct io_uring_sqe* sqe = ring->sqes + index;
+		memset(sqe,0,sizeof(*sqe));
+		sqe->opcode = IORING_OP_READ;
+		sqe->fd = fd;
+		sqe->addr = (uintptr_t)reads[i].buf;
+		sqe->len = reads[i].length > HFS_URING_MAX_LEN ? HFS_URING_MAX_LEN : reads[i].length;
+		sqe->off = reads[i].offset;
+		sqe->user_data = i;
+		ring->sq_array[index] = index;
+		tail++;
+		queued++;
+	}
+	__atomic_store_n(ring->sq_tail,tail,__ATOMIC_RELEASE);
+
+	int ret = 0;
+	unsigned submitted = 0;
+	while(submitted < queued) {
+		int n = hfs_uring_enter(ring,queued - submitted,0);
+		if(n < 0) {
+			ret = n;
+			break;
+		}
+		submitted += n;
+	}
+	if(submitted < queued) {
+		// take back whatever the kernel didn't consume so the next batch doesn't submit it
+		submitted = __atomic_load_n(ring->sq_head,__ATOMIC_ACQUIRE) - start;
+		__atomic_store_n(ring->sq_tail,start + submitted,__ATOMIC_RELEASE);
+	}
+
+	// reap everything submitted even after an error, as the kernel may still be writing to the buffers
+	// and stale completions would otherwise be matched against the next batch's reads
+	for(unsigned reaped = 0; reaped < submitted;) {
+		unsigned head = *ring->cq_head, cq_tail = __atomic_load_n(ring->cq_tail,__ATOMIC_ACQUIRE);
+		if(head == cq_tail) {
+			int err = hfs_uring_enter(ring,0,1);
+			if(err < 0) {
+				ring->broken = true;
+				return err;
+			}
+			continue;
+		}
+		for(; head != cq_tail; head++, reaped++) {
+			struct io_uring_cqe* cqe = ring->cqes + (head & *ring->cq_mask);
+			struct hfs_uring_read* r = reads + cqe->user_data;
+			if(cqe->res > 0) {
+				r->buf += cqe->res;
+				r->offset += cqe->res;
+				r->length -= cqe->res;
+			}
+			else if(!cqe->res)
+				ret = -EINVAL; // requested read beyond EOF
+			else if(cqe->res != -EAGAIN && cqe->res != -EINTR)
+				ret = cqe->res;
+		}
+		__atomic_store_n(ring->cq_head,head,__ATOMIC_RELEASE);
+	}
+	return ret;
+}
+
+int hfs_uring_readv(int fd, const hfs_io_segment_t* segs, uint32_t count, uint64_t base) {
+	struct hfs_uring* ring = hfs_uring_get();
+	if(!ring)
+		return -EOPNOTSUPP;
+
+	struct hfs_uring_read reads[HFS_URING_ENTRIES];
+	unsigned batch = ring->entries < HFS_URING_ENTRIES ? ring->entries : HFS_URING_ENTRIES;
+	for(uint32_t i = 0; i < count; i += batch) {
+		unsigned n = count - i < batch ? count - i : batch;
+		bool pending = false;
+		for(unsigned j = 0; j < n; j++) {
+			reads[j] = (struct hfs_uring_read){segs[i+j].buffer, segs[i+j].length, base + segs[i+j].offset};
+			pending = pending || reads[j].length;
+		}
+		while(pending) {
+			int ret = hfs_uring_submit(ring,fd,reads,n);
+			if(ret) {
+				// completions are still outstanding, so start over with a fresh ring on the next read
+				if(ring->broken) {
+					pthread_setspecific(hfs_uring_key,NULL);
+					hfs_uring_destroy(ring);
+				}
+				return ret;
+			}
+			pending = false;
+			for(unsigned j = 0; j < n; j++)
+				pending = pending || reads[j].length;
+		}
+	}
+	return 0;
+}
+
+#else
+
+bool hfs_uring_available(void) {
+	return false;
+}
+
+int hfs_uring_readv(int fd, const hfs_io_segment_t* segs, uint32_t count, uint64_t base) {
+	return -EOPNOTSUPP;
+}
+
+#endif
@@ -0,0 +1,24 @@
+/*
+ * libhfsuser - Userspace support library for NetBSD's libhfs
+ * This file is part of the hfsfuse project.
+ */
+
+#ifndef HFSUSER_URING_H
+#define HFSUSER_URING_H
+
+#include "hfsuser.h"
+
+#include <stdbool.h>
+
+// reads submitted in batches through an io_uring belonging to the calling thread, set up on its first use
+// without HAVE_IO_URING no ring is ever available
+
+// sets up the calling thread's ring if needed, returning false if io_uring can't be used
+// a process forking after this gives the child a ring of its own when it next reads
+bool hfs_uring_available(void);
+
+// reads every segment from fd, adding base to their offsets
+// returns 0 on success, negative errno on failure, or -EOPNOTSUPP if the calling thread has no ring, so the caller should read some other way
+int hfs_uring_readv(int fd, const hfs_io_segment_t* segs, uint32_t count, uint64_t base);
+
+#endif
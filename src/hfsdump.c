@@ -172,14 +172,14 @@ int main(int argc, char* argv[]) {
 		);
 		if(hfs_get_lib_features() & HFS_LIB_FEATURES_UBLIO)
 			fprintf(stderr, "    ublio v%s\n", hfs_lib_ublio_version());
-		if(hfs_get_lib_features() & HFS_LIB_FEATURES_UTF8PROC)
-			fprintf(stderr, "    utf8proc v%s\n", hfs_lib_utf8proc_version());
 		if(hfs_get_lib_features() & HFS_LIB_FEATURES_ZLIB)
 			fprintf(stderr, "    zlib v%s\n", hfs_lib_zlib_version());
 		if(hfs_get_lib_features() & HFS_LIB_FEATURES_LZFSE)
 			fprintf(stderr, "    LZFSE\n");
 		if(hfs_get_lib_features() & HFS_LIB_FEATURES_LZVN)
 			fprintf(stderr, "    LZVN\n");
+		if(hfs_get_lib_features() & HFS_LIB_FEATURES_IO_URING)
+			fprintf(stderr, "    io_uring\n");
 		return 0;
 	}
 
@@ -190,6 +190,8 @@ int main(int argc, char* argv[]) {
 	struct hfs_volume_config cfg;
 	hfs_volume_config_defaults(&cfg);
 	cfg.cache_size = 0;
+	cfg.dentry_cache_size = 0;
+	cfg.negative_cache_size = 0;
 
 	int ret = 0;
 	if((ret = hfs_open_volume(argv[1],&vol,&cfg))) {
@@ -234,18 +236,14 @@ int main(int argc, char* argv[]) {
 	}
 	else if(!strcmp(argv[2], "read")) {
 		if(rec.type == HFS_REC_FLDR) {
-			hfs_catalog_keyed_record_t* recs;
-			hfs_unistr255_t* names;
-			uint32_t count;
-			if((ret = hfslib_get_directory_contents(&vol,rec.folder.cnid,&recs,&names,&count,NULL)))
+			struct hfs_dir_listing listing;
+			if((ret = hfs_get_directory_listing(&vol,rec.folder.cnid,&listing))) {
+				fprintf(stderr,"%s\n",strerror(-ret));
 				goto end;
-			for(size_t i = 0; i < count; i++) {
-				char name[HFS_NAME_MAX+1];
-				hfs_pathname_to_unix(names+i,name);
-				puts(name);
 			}
-			free(names);
-			free(recs);
+			for(uint32_t i = 0; i < listing.count; i++)
+				puts(hfs_dirent_name(&listing,listing.entries+i,NULL));
+			hfs_free_directory_listing(&listing);
 		}
 		else if(rec.type == HFS_REC_FILE) {
 			set_stdout_binary();
@@ -17,6 +17,18 @@
 #include <fuse3/fuse.h>
 #endif
 
+// the low-level API is used with -o lowlevel, where requests name inodes rather than paths
+#if FUSE_VERSION >= 30 && !defined(__APPLE__) && !defined(__HAIKU__)
+#define HFSFUSE_LOWLEVEL 1
+#include <fuse3/fuse_lowlevel.h>
+#include "uthash.h"
+#endif
+
+// directory listings can be kept in the kernel's page cache from FUSE 3.5
+#if FUSE_VERSION >= 35 && !defined(__APPLE__) && !defined(__HAIKU__)
+#define HFSFUSE_CACHE_READDIR 1
+#endif
+
 #include <syslog.h>
 
 #ifndef HFSFUSE_VERSION_STRING
@@ -39,6 +51,21 @@ typedef struct stat stat_type;
 typedef fuse_fill_dir_t fill_dir_type;
 #endif
 
+// whether readdir passes full attributes for each entry, set by -o readdirplus
+// auto leaves it to the kernel, which asks for them once it sees the entries being looked up
+static enum hfsfuse_readdirplus {
+	HFSFUSE_READDIRPLUS_AUTO,
+	HFSFUSE_READDIRPLUS_NO,
+	HFSFUSE_READDIRPLUS_YES,
+} hfsfuse_readdirplus;
+
+// seconds the kernel may cache name lookups, attributes and nonexistent names for
+// nothing on the volume can change while it's mounted, so the defaults are effectively forever
+#define HFSFUSE_TIMEOUT_DEFAULT (365*24*60*60.0)
+static struct hfsfuse_timeouts {
+	double entry, attr, negative;
+} hfsfuse_timeouts;
+
 struct hfsfuse_file {
 	struct hfs_file* file;
 	pthread_rwlock_t lock;
@@ -48,6 +75,17 @@ struct hfsfuse_file {
 static void* hfsfuse_init(struct fuse_conn_info *conn, struct fuse_config *cfg) {
 	cfg->use_ino = 1;
 	cfg->nullpath_ok = 1;
+	cfg->entry_timeout = hfsfuse_timeouts.entry;
+	cfg->attr_timeout = hfsfuse_timeouts.attr;
+	cfg->negative_timeout = hfsfuse_timeouts.negative;
+#ifdef FUSE_CAP_READDIRPLUS
+	if(hfsfuse_readdirplus == HFSFUSE_READDIRPLUS_NO)
+		conn->want &= ~FUSE_CAP_READDIRPLUS;
+#ifdef FUSE_CAP_READDIRPLUS_AUTO
+	else if(hfsfuse_readdirplus == HFSFUSE_READDIRPLUS_YES)
+		conn->want &= ~FUSE_CAP_READDIRPLUS_AUTO;
+#endif
+#endif
 	return fuse_get_context()->private_data; // the hfs_volume
 }
 #endif
@@ -56,8 +94,8 @@ static void hfsfuse_destroy(void* vol) {
 	hfslib_close_volume(vol, NULL);
 }
 
-static int hfsfuse_open(const char* path, struct fuse_file_info* info) {
-	hfs_volume* vol = fuse_get_context()->private_data;
+// opens the file at path, or the given fork of rec if path is NULL
+static int hfsfuse_file_open(hfs_volume* vol, const char* path, hfs_catalog_keyed_record_t* rec, uint8_t fork, struct fuse_file_info* info) {
 	struct hfsfuse_file* f = malloc(sizeof(*f));
 	if(!f)
 		return -ENOMEM;
@@ -65,7 +103,7 @@ static int hfsfuse_open(const char* path, struct fuse_file_info* info) {
 	int ret = -pthread_rwlock_init(&f->lock,NULL);
 	if(ret)
 		goto err;
-	if(!(f->file = hfs_file_open_path(vol,path,&ret))) {
+	if(!(f->file = path ? hfs_file_open_path(vol,path,&ret) : hfs_file_open(vol,rec,fork,&ret))) {
 		pthread_rwlock_destroy(&f->lock);
 		goto err;
 	}
@@ -80,8 +118,7 @@ err:
 	return ret;
 }
 
-static int hfsfuse_release(const char* path, struct fuse_file_info* info) {
-	struct hfsfuse_file* f = (struct hfsfuse_file*)info->fh;
+static int hfsfuse_file_close(struct hfsfuse_file* f) {
 	int ret = -pthread_rwlock_wrlock(&f->lock);
 	if(ret)
 		return ret;
@@ -94,14 +131,26 @@ static int hfsfuse_release(const char* path, struct fuse_file_info* info) {
 	return 0;
 }
 
-static int hfsfuse_read(const char* path, char* buf, size_t size, off_t offset, struct fuse_file_info* info) {
-	struct hfsfuse_file* f = (struct hfsfuse_file*)info->fh;
+static ssize_t hfsfuse_file_pread(struct hfsfuse_file* f, char* buf, size_t size, off_t offset) {
 	int ret = -pthread_rwlock_tryrdlock(&f->lock);
 	if(ret)
 		return ret;
 
 	ssize_t bytes = hfs_file_pread(f->file,buf,size,offset);
 	pthread_rwlock_unlock(&f->lock);
+	return bytes;
+}
+
+static int hfsfuse_open(const char* path, struct fuse_file_info* info) {
+	return hfsfuse_file_open(fuse_get_context()->private_data,path,NULL,0,info);
+}
+
+static int hfsfuse_release(const char* path, struct fuse_file_info* info) {
+	return hfsfuse_file_close((struct hfsfuse_file*)info->fh);
+}
+
+static int hfsfuse_read(const char* path, char* buf, size_t size, off_t offset, struct fuse_file_info* info) {
+	ssize_t bytes = hfsfuse_file_pread((struct hfsfuse_file*)info->fh,buf,size,offset);
 	if(bytes > INT_MAX)
 		return -EINVAL;
 	return bytes;
@@ -128,7 +177,7 @@ static int hfsfuse_readlink(const char* path, char* buf, size_t size) {
 
 #if FUSE_DARWIN_ENABLE_EXTENSIONS
 #if HAVE_DARWIN_ATTR_CRTIME
-#define stat_to_fuse_darwin_attr(rec,st) ((struct fuse_darwin_attr){\
+#define stat_to_fuse_darwin_attr(backup,st) ((struct fuse_darwin_attr){\
 	.ino = (st).st_ino,\
 	.mode = (st).st_mode,\
 	.nlink = (st).st_nlink,\
@@ -139,14 +188,14 @@ static int hfsfuse_readlink(const char* path, char* buf, size_t size) {
 	.mtimespec.tv_sec = (st).st_mtime,\
 	.ctimespec.tv_sec = (st).st_ctime,\
 	.crtimespec.tv_sec = (st).st_birthtime,\
-	.bkuptimespec.tv_sec = HFSTIMETOEPOCH((rec).file.date_backedup),\
+	.bkuptimespec.tv_sec = HFSTIMETOEPOCH(backup),\
 	.size = (st).st_size,\
 	.blocks = (st).st_blocks,\
 	.blksize = (st).st_blksize,\
 	.flags = (st).st_flags,\
 })
 #else
-#define stat_to_fuse_darwin_attr(rec,st) ((struct fuse_darwin_attr){\
+#define stat_to_fuse_darwin_attr(backup,st) ((struct fuse_darwin_attr){\
 	.ino = (st).st_ino,\
 	.mode = (st).st_mode,\
 	.nlink = (st).st_nlink,\
@@ -157,7 +206,7 @@ static int hfsfuse_readlink(const char* path, char* buf, size_t size) {
 	.mtimespec.tv_sec = (st).st_mtime,\
 	.ctimespec.tv_sec = (st).st_ctime,\
 	.btimespec.tv_sec = (st).st_birthtime,\
-	.bkuptimespec.tv_sec = HFSTIMETOEPOCH((rec).file.date_backedup),\
+	.bkuptimespec.tv_sec = HFSTIMETOEPOCH(backup),\
 	.size = (st).st_size,\
 	.blocks = (st).st_blocks,\
 	.blksize = (st).st_blksize,\
@@ -177,7 +226,7 @@ static int hfsfuse_fgetattr(const char* path, stat_type* st, struct fuse_file_in
 	struct stat stbuf;
 	hfs_catalog_keyed_record_t rec = hfs_file_get_catalog_record(f->file);
 	hfs_file_stat(f->file,&stbuf);
-	*st = stat_to_fuse_darwin_attr(rec,stbuf);
+	*st = stat_to_fuse_darwin_attr(rec.file.date_backedup,stbuf);
 #else
 	hfs_file_stat(f->file,st);
 #endif
@@ -209,7 +258,7 @@ static int hfsfuse_getattr(const char* path, struct stat* st) {
 #if FUSE_DARWIN_ENABLE_EXTENSIONS
 	struct stat statbuf;
 	hfs_stat(vol,&rec,&statbuf,fork);
-	*st = stat_to_fuse_darwin_attr(rec,statbuf);
+	*st = stat_to_fuse_darwin_attr(rec.file.date_backedup,statbuf);
 #else
 	hfs_stat(vol,&rec,st,fork);
 #endif
@@ -270,24 +319,41 @@ static int hfsfuse_statx(const char* path, int flags, int mask, struct statx* st
 }
 #endif
 
+// entries read from the catalog at a time by readdir
+#define HFSFUSE_READAHEAD 32
+
 struct hfsfuse_dir {
 	hfs_catalog_keyed_record_t dir_record;
 	hfs_cnid_t parent_cnid;
-	hfs_catalog_keyed_record_t* records;
-	hfs_unistr255_t* names;
-	uint32_t nentries;
-	char* path;
-	size_t pathlen;
+	// readdir offsets are cursor positions from hfslib_tell_directory, with 2 being the first entry
+	// a cached listing is read if there is one, otherwise the catalog is read through the cursor
+	const struct hfs_dir_listing* listing;
+	uint32_t index; // next entry of listing
+	hfs_dir_cursor_t cursor;
+	// entries are read from the cursor a window at a time, so their decmpfs headers can be looked up together
+	struct hfs_dir_listing window;
+	uint32_t window_index; // next entry of window
+	off_t pos; // offset of the window's first entry, 0 if the cursor is lost
+	bool window_plus; // whether hard links in the window were resolved and compression looked up
+	// entries read through the cursor from the start are collected into a listing, which is cached once complete
+	struct hfs_dir_listing building;
+	size_t build_limit;
+	bool build;
+	char* path; // with room for a child's name, which is all it holds if pathlen is 0
+	size_t pathlen; // 0 if the paths of entries aren't cached
+
 	pthread_rwlock_t lock;
 };
 
-int hfsfuse_dir_close(struct hfsfuse_dir* d) {
+static int hfsfuse_dir_close(hfs_volume* vol, struct hfsfuse_dir* d) {
 	int ret = pthread_rwlock_wrlock(&d->lock);
 	if(ret)
 		return -ret;
 
-	free(d->names);
-	free(d->records);
+	hfs_release_directory_listing(vol,d->listing);
+	hfslib_close_directory(vol,&d->cursor,NULL);
+	hfs_free_directory_listing(&d->window);
+	hfs_free_directory_listing(&d->building);
 	free(d->path);
 	pthread_rwlock_unlock(&d->lock);
 	pthread_rwlock_destroy(&d->lock);
@@ -295,8 +361,8 @@ int hfsfuse_dir_close(struct hfsfuse_dir* d) {
 	return 0;
 }
 
-static int hfsfuse_opendir(const char* path, struct fuse_file_info* info) {
-	hfs_volume* vol = fuse_get_context()->private_data;
+// the paths of entries read from the catalog are cached under path, unless it's NULL
+static int hfsfuse_dir_open(hfs_volume* vol, const hfs_catalog_keyed_record_t* rec, hfs_cnid_t parent_cnid, const char* path, struct hfsfuse_dir** out) {
 	struct hfsfuse_dir* d = malloc(sizeof(*d));
 	if(!d)
 		return -ENOMEM;
@@ -307,52 +373,178 @@ static int hfsfuse_opendir(const char* path, struct fuse_file_info* info) {
 		return ret;
 	}
 
-	d->names = NULL;
-	d->records = NULL;
-	d->path = NULL;
-
-	hfs_catalog_key_t key;
-	ret = hfs_lookup(vol,path,&d->dir_record,&key,NULL);
-	if(ret)
-		goto end;
-	d->parent_cnid = key.parent_cnid;
-
-	d->pathlen = strlen(path);
-	if(d->pathlen > 1)
+	d->listing = NULL;
+	d->index = 0;
+	d->cursor.buffer = NULL;
+	d->window = (struct hfs_dir_listing){0};
+	d->window_index = 0;
+	d->pos = 2;
+	d->window_plus = false;
+	d->building = (struct hfs_dir_listing){0};
+	d->build_limit = 0;
+	d->build = false;
+	d->dir_record = *rec;
+	d->parent_cnid = parent_cnid;
+
+	d->pathlen = 0;
+	if(path && (d->pathlen = strlen(path)) > 1)
 		d->pathlen++;
-	if(!(d->path = malloc(d->pathlen))) {
+	if(!(d->path = malloc(d->pathlen+HFS_NAME_MAX+1))) {
 		ret = -ENOMEM;
 		goto end;
 	}
 	if(d->pathlen > 1)
 		memcpy(d->path,path,d->pathlen-1);
-	d->path[d->pathlen-1] = '/';
+	if(d->pathlen)
+		d->path[d->pathlen-1] = '/';
 
-	if(hfslib_get_directory_contents(vol,d->dir_record.folder.cnid,&d->records,&d->names,&d->nentries,NULL)) {
-		ret = -1;
-		goto end;
+	if(!(d->listing = hfs_lookup_directory_listing(vol,d->dir_record.folder.cnid))) {
+		if(hfslib_open_directory(vol,d->dir_record.folder.cnid,&d->cursor,NULL)) {
+			ret = -EIO;
+			goto end;
+		}
+		struct hfs_dir_cache_stats stats;
+		hfs_get_dir_cache_stats(vol,&stats);
+		d->build_limit = stats.max_bytes;
+		d->build = d->build_limit != 0;
 	}
 
-	info->fh = (uint64_t)d;
+	*out = d;
 
 end:
 	if(ret)
-		hfsfuse_dir_close(d);
+		hfsfuse_dir_close(vol,d);
 	return ret;
 }
 
+static int hfsfuse_opendir(const char* path, struct fuse_file_info* info) {
+	hfs_volume* vol = fuse_get_context()->private_data;
+	hfs_catalog_keyed_record_t rec;
+	hfs_catalog_key_t key;
+	int ret = hfs_lookup(vol,path,&rec,&key,NULL);
+	if(ret)
+		return ret;
+
+	struct hfsfuse_dir* d;
+	if((ret = hfsfuse_dir_open(vol,&rec,key.parent_cnid,path,&d)))
+		return ret;
+
+	info->fh = (uint64_t)d;
+#if HFSFUSE_CACHE_READDIR
+	info->cache_readdir = 1;
+	info->keep_cache = 1;
+#endif
+	return 0;
+}
+
 static int hfsfuse_releasedir(const char* path, struct fuse_file_info* info) {
-	return hfsfuse_dir_close((struct hfsfuse_dir*)info->fh);
+	return hfsfuse_dir_close(fuse_get_context()->private_data,(struct hfsfuse_dir*)info->fh);
 }
 
-#if FUSE_VERSION >= 30
-static int hfsfuse_readdir(const char* path, void* buf, fill_dir_type filler, off_t offset, struct fuse_file_info* info, enum fuse_readdir_flags flags) {
+// without plus only the type and inode number are used, so compression isn't looked up
+static int hfsfuse_fill_dirent(hfs_volume* vol, void* buf, fill_dir_type filler, const char* name, const struct hfs_dirent* ent, bool plus) {
+	struct stat st;
+	if(plus)
+		hfs_dirent_stat(vol,ent,&st);
+	else hfs_dirent_stat_with_decmpfs_header(vol,ent,&st,NULL);
+#if FUSE_DARWIN_ENABLE_EXTENSIONS
+	return filler(buf,name,&stat_to_fuse_darwin_attr(ent->date_backedup,st),ent->pos,plus ? FUSE_FILL_DIR_PLUS : 0);
+#elif FUSE_VERSION >= 30
+	return filler(buf,name,&st,ent->pos,plus ? FUSE_FILL_DIR_PLUS : 0);
 #else
-static int hfsfuse_readdir(const char* path, void* buf, fuse_fill_dir_t filler, off_t offset, struct fuse_file_info* info) {
+	return filler(buf,name,&st,ent->pos);
 #endif
-	hfs_volume* vol = fuse_get_context()->private_data;
-	struct hfsfuse_dir* d = (struct hfsfuse_dir*)info->fh;
-	int ret = -pthread_rwlock_tryrdlock(&d->lock);
+}
+
+// sets the window's next entry to the one following offset, returning false if offset isn't in the window
+static bool hfsfuse_dir_window_seek(struct hfsfuse_dir* d, off_t offset) {
+	for(uint32_t i = 0; i <= d->window.count; i++)
+		if((i ? (off_t)d->window.entries[i-1].pos : d->pos) == offset) {
+			d->window_index = i;
+			return true;
+		}
+	return false;
+}
+
+// for readdir without plus, a hard link's type and inode number are taken from the link record instead of looking up its target
+static void hfsfuse_dirent_from_link(const hfs_catalog_keyed_record_t* rec, struct hfs_dirent* ent) {
+	uint16_t type;
+	if(rec->file.user_info.file_creator == HFS_HFSPLUS_CREATOR && rec->file.user_info.file_type == HFS_HARD_LINK_FILE_TYPE)
+		type = HFS_S_IFREG;
+	else if(rec->file.user_info.file_creator == HFS_MACS_CREATOR && rec->file.user_info.file_type == HFS_DIR_HARD_LINK_FILE_TYPE)
+		type = HFS_S_IFDIR;
+	else return;
+	ent->link = ent->cnid;
+	ent->cnid = rec->file.bsd.special.inode_num;
+	ent->file_mode = (ent->file_mode & ~HFS_S_IFMT) | type;
+}
+
+// replaces the window with the next HFSFUSE_READAHEAD entries from the cursor, returning how many were read or negative errno
+// entries are collected into the listing being built with their hard links resolved, with or without plus
+static int hfsfuse_dir_read_ahead(hfs_volume* vol, struct hfsfuse_dir* d, bool plus) {
+	struct hfs_dir_listing* w = &d->window;
+	if(w->count)
+		d->pos = w->entries[w->count-1].pos;
+	w->count = 0;
+	w->names_size = 0;
+	d->window_index = 0;
+	d->window_plus = plus;
+
+	char* pelem = d->path + d->pathlen;
+	hfs_catalog_keyed_record_t record;
+	hfs_catalog_key_t key;
+	int ret, err = 0;
+	while(w->count < HFSFUSE_READAHEAD && !(err = hfslib_read_directory(vol,&d->cursor,&record,&key,NULL))) {
+		// skip names that can't be represented, as listings do
+		ssize_t len = hfs_pathname_to_unix(&key.name,pelem);
+		if(len < 0)
+			continue;
+
+		struct hfs_dirent ent;
+		// resolving only looks anything up for the links themselves
+		if(plus || d->build) {
+			hfs_cnid_t link = hfs_resolve_hardlink(vol,&record);
+			if(d->pathlen)
+				hfs_cache_path(vol,d->path,d->pathlen+len,&record);
+			hfs_dirent_from_record(&record,HFS_DATAFORK,&ent);
+			ent.link = link;
+		}
+		else {
+			hfs_dirent_from_record(&record,HFS_DATAFORK,&ent);
+			hfsfuse_dirent_from_link(&record,&ent);
+			// an unresolved hard link mustn't be found by later lookups
+			if(!ent.link && d->pathlen)
+				hfs_cache_path(vol,d->path,d->pathlen+len,&record);
+		}
+		ent.pos = hfslib_tell_directory(&d->cursor);
+		if((ret = hfs_dir_listing_append(w,&ent,pelem,len)))
+			return ret;
+	}
+	if(err > 0)
+		return -EIO;
+
+	if(plus)
+		hfs_decmpfs_lookup_batch(vol,w->entries,w->count);
+
+	for(uint32_t i = 0; d->build && i < w->count; i++) {
+		size_t len;
+		const char* name = hfs_dirent_name(w,w->entries+i,&len);
+		if(hfs_dir_listing_append(&d->building,w->entries+i,name,len) ||
+		   d->building.count*sizeof(*d->building.entries) + d->building.names_size > d->build_limit) {
+			hfs_free_directory_listing(&d->building);
+			d->build = false;
+		}
+	}
+	if(err < 0 && d->build) {
+		hfs_cache_directory_listing(vol,d->dir_record.folder.cnid,&d->building);
+		d->build = false;
+	}
+	return w->count;
+}
+
+// passes the entries of d following offset to filler until it's full
+static int hfsfuse_dir_fill(hfs_volume* vol, struct hfsfuse_dir* d, void* buf, fill_dir_type filler, off_t offset, bool plus) {
+	int ret = -pthread_rwlock_wrlock(&d->lock);
 	if(ret)
 		return ret;
 
@@ -360,9 +552,9 @@ static int hfsfuse_readdir(const char* path, void* buf, fuse_fill_dir_t filler,
 		struct stat st = {0};
 		hfs_stat(vol, &d->dir_record, &st, 0);
 #if FUSE_DARWIN_ENABLE_EXTENSIONS
-		ret = filler(buf, ".", &stat_to_fuse_darwin_attr(d->dir_record,st), 1, FUSE_FILL_DIR_PLUS);
+		ret = filler(buf, ".", &stat_to_fuse_darwin_attr(d->dir_record.file.date_backedup,st), 1, plus ? FUSE_FILL_DIR_PLUS : 0);
 #elif FUSE_VERSION >= 30
-		ret = filler(buf, ".", &st, 1, FUSE_FILL_DIR_PLUS);
+		ret = filler(buf, ".", &st, 1, plus ? FUSE_FILL_DIR_PLUS : 0);
 #else
 		ret = filler(buf, ".", &st, 1);
 #endif
@@ -374,16 +566,22 @@ static int hfsfuse_readdir(const char* path, void* buf, fuse_fill_dir_t filler,
 		struct stat* stp = NULL;
 		hfs_catalog_keyed_record_t rec = {0};
 		if(d->dir_record.folder.cnid != HFS_CNID_ROOT_FOLDER) {
-			hfs_catalog_key_t key;
-			hfslib_find_catalog_record_with_cnid(vol, d->parent_cnid, &rec, &key, NULL);
 			stp = &st;
-			hfs_stat(vol, &rec, stp, 0);
+			if(plus) {
+				hfs_catalog_key_t key;
+				hfslib_find_catalog_record_with_cnid(vol, d->parent_cnid, &rec, &key, NULL);
+				hfs_stat(vol, &rec, stp, 0);
+			}
+			else {
+				st.st_ino = d->parent_cnid;
+				st.st_mode = S_IFDIR;
+			}
 		}
 		int ret;
 #if FUSE_DARWIN_ENABLE_EXTENSIONS
-		ret = filler(buf, "..", stp ? &stat_to_fuse_darwin_attr(rec,*stp) : NULL, 2, stp ? FUSE_FILL_DIR_PLUS : 0);
+		ret = filler(buf, "..", stp ? &stat_to_fuse_darwin_attr(rec.file.date_backedup,*stp) : NULL, 2, stp && plus ? FUSE_FILL_DIR_PLUS : 0);
 #elif FUSE_VERSION >= 30
-		ret = filler(buf, "..", stp, 2, stp ? FUSE_FILL_DIR_PLUS : 0);
+		ret = filler(buf, "..", stp, 2, stp && plus ? FUSE_FILL_DIR_PLUS : 0);
 #else
 		ret = filler(buf, "..", stp, 2);
 #endif
@@ -391,59 +589,85 @@ static int hfsfuse_readdir(const char* path, void* buf, fuse_fill_dir_t filler,
 			goto end;
 	}
 
-	char* fullpath = malloc(d->pathlen+HFS_NAME_MAX+1);
-	if(!fullpath)
-		return -ENOMEM;
-
-	memcpy(fullpath,d->path,d->pathlen);
-	char* pelem = fullpath + d->pathlen;
 	ret = 0;
-	for(off_t i = max(0,offset-2); i < d->nentries; i++) {
-		ssize_t len;
-		if((len = hfs_pathname_to_unix(d->names+i,pelem)) < 0) {
-			ret = len;
-			continue;
-		}
-
-		hfs_catalog_keyed_record_t* record = d->records + i;
-
-		hfs_catalog_keyed_record_t link;
-		if(record->type == HFS_REC_FILE) {
-			if(record->file.user_info.file_creator == HFS_HFSPLUS_CREATOR &&
-		       record->file.user_info.file_type == HFS_HARD_LINK_FILE_TYPE) {
-				if(!hfslib_get_hardlink(vol, record->file.bsd.special.inode_num, &link, NULL))
-					record = &link;
-			}
-			else if(record->file.user_info.file_creator == HFS_MACS_CREATOR &&
-			        record->file.user_info.file_type == HFS_DIR_HARD_LINK_FILE_TYPE) {
-		   		if(!hfslib_get_directory_hardlink(vol, record->file.bsd.special.inode_num, &link, NULL))
-					record = &link;
+	off_t start = max(offset,2);
+
+	if(d->listing) {
+		// entries are found by the position they were read at, so offsets are the same as those handed out while reading the catalog
+		const struct hfs_dir_listing* l = d->listing;
+		uint32_t i = d->index;
+		if(start != (i ? (off_t)l->entries[i-1].pos : 2)) {
+			if(start == 2)
+				i = 0;
+			else {
+				for(i = 0; i < l->count && (off_t)l->entries[i].pos != start; i++);
+				// a position the listing skipped, e.g. a name that couldn't be converted, so go to the catalog instead
+				if(i == l->count) {
+					hfs_release_directory_listing(vol,l);
+					d->listing = NULL;
+					if(hfslib_open_directory(vol,d->dir_record.folder.cnid,&d->cursor,NULL)) {
+						ret = -EIO;
+						goto end;
+					}
+					d->pos = 2;
+					goto catalog;
+				}
+				i++;
 			}
 		}
+		for(; i < l->count; i++)
+			if(hfsfuse_fill_dirent(vol,buf,filler,hfs_dirent_name(l,l->entries+i,NULL),l->entries+i,plus))
+				break;
+		d->index = i;
+		goto end;
+	}
 
-		hfs_cache_path(vol,fullpath,d->pathlen+len,record);
+catalog:
+	// the offset names where to resume in the catalog, so the cursor only needs to move if that isn't in the window or right after it
+	// entries read ahead without plus are read again if they're now wanted with it
+	if(!hfsfuse_dir_window_seek(d,start) || (plus && !d->window_plus && d->window_index < d->window.count)) {
+		// a listing is only complete if collected from the first entry onwards
+		d->building.count = 0;
+		d->building.names_size = 0;
+		d->build = start == 2 && d->build_limit;
+
+		d->window.count = 0;
+		d->window.names_size = 0;
+		d->window_index = 0;
+		d->pos = 0;
+		if(start == 2 ? hfslib_seek_directory(vol,&d->cursor,NULL,NULL) : hfslib_seek_directory_position(vol,&d->cursor,start,NULL)) {
+			ret = -EIO;
+			goto end;
+		}
+		d->pos = start;
+	}
 
-		struct stat st = {0};
-		hfs_stat(vol,record,&st,0);
-		int ret;
-#if FUSE_DARWIN_ENABLE_EXTENSIONS
-		ret = filler(buf,pelem,&stat_to_fuse_darwin_attr(*record,st),i+3,FUSE_FILL_DIR_PLUS);
-#elif FUSE_VERSION >= 30
-		ret = filler(buf,pelem,&st,i+3,FUSE_FILL_DIR_PLUS);
-#else
-		ret = filler(buf,pelem,&st,i+3);
-#endif
-		if(ret)
+	while(1) {
+		if(d->window_index == d->window.count && (ret = hfsfuse_dir_read_ahead(vol,d,plus)) <= 0)
+			break;
+		// the buffer is full, so hand this entry out first next time
+		const struct hfs_dirent* ent = d->window.entries + d->window_index;
+		if(hfsfuse_fill_dirent(vol,buf,filler,hfs_dirent_name(&d->window,ent,NULL),ent,plus))
 			break;
+		d->window_index++;
 	}
 
-	free(fullpath);
-
 end:
 	pthread_rwlock_unlock(&d->lock);
 	return min(ret,0);
 }
 
+#if FUSE_VERSION >= 30
+static int hfsfuse_readdir(const char* path, void* buf, fill_dir_type filler, off_t offset, struct fuse_file_info* info, enum fuse_readdir_flags flags) {
+	bool plus = flags & FUSE_READDIR_PLUS;
+#else
+static int hfsfuse_readdir(const char* path, void* buf, fuse_fill_dir_t filler, off_t offset, struct fuse_file_info* info) {
+	// FUSE 2 only takes the type and inode number from readdir
+	bool plus = false;
+#endif
+	return hfsfuse_dir_fill(fuse_get_context()->private_data,(struct hfsfuse_dir*)info->fh,buf,filler,offset,plus);
+}
+
 #if FUSE_DARWIN_ENABLE_EXTENSIONS
 static int hfsfuse_statfs(const char* path, struct statfs* st) {
 	hfs_volume* vol = fuse_get_context()->private_data;
@@ -456,8 +680,7 @@ static int hfsfuse_statfs(const char* path, struct statfs* st) {
 	return 0;
 }
 #else
-static int hfsfuse_statfs(const char* path, struct statvfs* st) {
-	hfs_volume* vol = fuse_get_context()->private_data;
+static void hfsfuse_statvfs(hfs_volume* vol, struct statvfs* st) {
 	st->f_bsize = vol->vh.block_size;
 	st->f_frsize = st->f_bsize;
 	st->f_blocks = vol->vh.total_blocks;
@@ -468,6 +691,10 @@ static int hfsfuse_statfs(const char* path, struct statvfs* st) {
 	st->f_favail = st->f_ffree;
 	st->f_flag = ST_RDONLY;
 	st->f_namemax = HFS_NAME_MAX;
+}
+
+static int hfsfuse_statfs(const char* path, struct statvfs* st) {
+	hfsfuse_statvfs(fuse_get_context()->private_data,st);
 	return 0;
 }
 #endif
@@ -501,38 +728,34 @@ static int hfsfuse_getxtimes(const char* path, struct timespec* bkuptime, struct
 	}\
 } while(0)
 
-static int hfsfuse_listxattr(const char* path, char* attr, size_t size) {
-	hfs_volume* vol = fuse_get_context()->private_data;
-	hfs_catalog_keyed_record_t rec;
-	int ret = hfs_lookup(vol,path,&rec,NULL,NULL);
-	if(ret)
-		return ret;
+static int hfsfuse_listxattr_record(hfs_volume* vol, hfs_catalog_keyed_record_t* rec, char* attr, size_t size) {
+	int ret = 0;
 
 #ifdef __linux__
 	if(!strcmp("user.",XATTR_NAMESPACE_STR)) {
 		// only regular files can contain user namespace xattrs on Linux
 		struct stat st;
-		hfs_stat(vol,&rec,&st,HFS_DATAFORK);
+		hfs_stat(vol,rec,&st,HFS_DATAFORK);
 		if(!(S_ISREG(st.st_mode) || S_ISDIR(st.st_mode)))
 			return 0;
 	}
 #endif
 
 	declare_attr("hfsfuse.record.date_created", attr, size, ret);
-	if(rec.file.date_backedup)
+	if(rec->file.date_backedup)
 		declare_attr("hfsfuse.record.date_backedup", attr, size, ret);
 
-	if(rec.type == HFS_REC_FILE && rec.file.rsrc_fork.logical_size && rec.file.rsrc_fork.logical_size <= INT_MAX)
+	if(rec->type == HFS_REC_FILE && rec->file.rsrc_fork.logical_size && rec->file.rsrc_fork.logical_size <= INT_MAX)
 		declare_attr("com.apple.ResourceFork", attr, size, ret);
 
 	char finderinfo[32];
-	hfs_serialize_finderinfo(&rec,finderinfo);
+	hfs_serialize_finderinfo(rec,finderinfo);
 	if(memcmp(finderinfo,(char[32]){0},32))
 		declare_attr("com.apple.FinderInfo", attr, size, ret);
 
 	hfs_attribute_key_t* attr_keys;
 	uint32_t nattrs;
-	if(hfslib_find_attribute_records_for_cnid(vol,rec.file.cnid,&attr_keys,&nattrs,NULL))
+	if(hfslib_find_attribute_records_for_cnid(vol,rec->file.cnid,&attr_keys,&nattrs,NULL))
 		return -1;
 	for(uint32_t i = 0; i < nattrs; i++) {
 		char attrname[HFS_NAME_MAX+1];
@@ -550,6 +773,15 @@ static int hfsfuse_listxattr(const char* path, char* attr, size_t size) {
 	return ret;
 }
 
+static int hfsfuse_listxattr(const char* path, char* attr, size_t size) {
+	hfs_volume* vol = fuse_get_context()->private_data;
+	hfs_catalog_keyed_record_t rec;
+	int ret = hfs_lookup(vol,path,&rec,NULL,NULL);
+	if(ret)
+		return ret;
+	return hfsfuse_listxattr_record(vol,&rec,attr,size);
+}
+
 #define define_attr(attr, name, size, attrsize, block) do {\
 	if(!strcmp(attr, attrname(name))) {\
 		if(size) {\
@@ -561,18 +793,14 @@ static int hfsfuse_listxattr(const char* path, char* attr, size_t size) {
 } while(0)
 
 // apple supports an offset argument to getxattr, but this is only used for resource fork attributes
-static int hfsfuse_getxattr_offset(const char* path, const char* attr, char* value, size_t size, uint32_t offset) {
-	hfs_volume* vol = fuse_get_context()->private_data;
-	hfs_catalog_keyed_record_t rec;
-	int ret = hfs_lookup(vol,path,&rec,NULL,NULL);
-	if(ret)
-		return ret;
+static int hfsfuse_getxattr_record(hfs_volume* vol, hfs_catalog_keyed_record_t* rec, const char* attr, char* value, size_t size, uint32_t offset) {
+	int ret;
 
 	define_attr(attr, "com.apple.FinderInfo", size, 32, {
-		hfs_serialize_finderinfo(&rec, value);
+		hfs_serialize_finderinfo(rec, value);
 	});
-	if(rec.type == HFS_REC_FILE && rec.file.rsrc_fork.logical_size && rec.file.rsrc_fork.logical_size <= INT_MAX) {
-		ret = rec.file.rsrc_fork.logical_size;
+	if(rec->type == HFS_REC_FILE && rec->file.rsrc_fork.logical_size && rec->file.rsrc_fork.logical_size <= INT_MAX) {
+		ret = rec->file.rsrc_fork.logical_size;
 		define_attr(attr, "com.apple.ResourceFork", size, ret, {
 			hfs_extent_descriptor_t* extents = NULL;
 			uint64_t bytes;
@@ -580,7 +808,7 @@ static int hfsfuse_getxattr_offset(const char* path, const char* attr, char* val
 				return 0;
 			if(size > ret - offset)
 				size = ret - offset;
-			uint16_t nextents = hfslib_get_file_extents(vol,rec.file.cnid,HFS_RSRCFORK,&extents,NULL);
+			uint16_t nextents = hfslib_get_fork_extents(vol,rec->file.cnid,HFS_RSRCFORK,&rec->file.rsrc_fork,&extents,NULL);
 			if((ret = hfslib_readd_with_extents(vol,value,&bytes,size,offset,extents,nextents,NULL)) >= 0)
 				ret = bytes;
 			else ret = -EIO;
@@ -593,7 +821,7 @@ static int hfsfuse_getxattr_offset(const char* path, const char* attr, char* val
 		// but we don't want this in the returned attribute value
 		char timebuf[25];
 		struct tm t;
-		localtime_r(&(time_t){HFSTIMETOEPOCH(rec.file.date_created)}, &t);
+		localtime_r(&(time_t){HFSTIMETOEPOCH(rec->file.date_created)}, &t);
 		strftime(timebuf, 25, "%FT%T%z", &t);
 		memcpy(value, timebuf, 24);
 	});
@@ -601,7 +829,7 @@ static int hfsfuse_getxattr_offset(const char* path, const char* attr, char* val
 	define_attr(attr, "hfsfuse.record.date_backedup", size, 24, {
 		char timebuf[25];
 		struct tm t;
-		localtime_r(&(time_t){HFSTIMETOEPOCH(rec.file.date_backedup)}, &t);
+		localtime_r(&(time_t){HFSTIMETOEPOCH(rec->file.date_backedup)}, &t);
 		strftime(timebuf, 25, "%FT%T%z", &t);
 		memcpy(value, timebuf, 24);
 	});
@@ -617,7 +845,7 @@ static int hfsfuse_getxattr_offset(const char* path, const char* attr, char* val
 	if(hfs_utf8_to_unistr(attr,&attrname) <= 0)
 		return -EINVAL;
 	hfs_attribute_key_t attrkey;
-	if(!hfslib_make_attribute_key(rec.file.cnid,0,attrname.length,attrname.unicode,&attrkey))
+	if(!hfslib_make_attribute_key(rec->file.cnid,0,attrname.length,attrname.unicode,&attrkey))
 		return -EFAULT; // cnid was 0
 	void* inlinedata = NULL;
 	if(hfslib_find_attribute_record_with_key(vol,&attrkey,&attrec,(size ? &inlinedata : NULL),NULL))
@@ -632,7 +860,7 @@ static int hfsfuse_getxattr_offset(const char* path, const char* attr, char* val
 			attrsize = attrec.fork_record.fork.logical_size;
 			break;
 		case HFS_ATTR_EXTENTS:
-			hfslib_error("unexpected extent attr found in getxattr. attr: %s path: %s\n", NULL, 0, attr, path);
+			hfslib_error("unexpected extent attr found in getxattr. attr: %s cnid: %" PRIu32 "\n", NULL, 0, attr, rec->file.cnid);
 			return -EFAULT;
 	}
 	if(size) {
@@ -670,6 +898,15 @@ end:
 	return ret;
 }
 
+static int hfsfuse_getxattr_offset(const char* path, const char* attr, char* value, size_t size, uint32_t offset) {
+	hfs_volume* vol = fuse_get_context()->private_data;
+	hfs_catalog_keyed_record_t rec;
+	int ret = hfs_lookup(vol,path,&rec,NULL,NULL);
+	if(ret)
+		return ret;
+	return hfsfuse_getxattr_record(vol,&rec,attr,value,size,offset);
+}
+
 #if !(FUSE_DARWIN_ENABLE_EXTENSIONS || (defined(__APPLE__) && FUSE_VERSION < 30))
 #ifdef __HAIKU__
 static inline char hex4b(uint8_t dec) {
@@ -735,6 +972,357 @@ static struct fuse_operations hfsfuse_ops = {
 #endif
 };
 
+#if HFSFUSE_LOWLEVEL
+// in low-level mode each name the kernel looks up is searched for once in its parent folder by CNID,
+// and the record found is kept in the inode table until the kernel forgets it. requests then refer to
+// records by their inode numbers, so paths are never resolved and the path cache goes unused
+
+struct hfsfuse_inode {
+	uint64_t key; // fork << 32 | CNID
+	uint64_t nlookup;
+	hfs_catalog_keyed_record_t record;
+	uint8_t fork;
+	hfs_cnid_t parent_cnid;
+	UT_hash_handle hash;
+};
+
+// inode numbers are the addresses of table entries, except for the root folder which is always FUSE_ROOT_ID
+struct hfsfuse_ll {
+	hfs_volume* vol;
+	struct hfsfuse_inode root;
+	struct hfsfuse_inode* inodes;
+	pthread_mutex_t lock;
+};
+
+static struct hfsfuse_inode* hfsfuse_ll_inode(struct hfsfuse_ll* ll, fuse_ino_t ino) {
+	return ino == FUSE_ROOT_ID ? &ll->root : (struct hfsfuse_inode*)(uintptr_t)ino;
+}
+
+// adds a lookup of rec's fork to the inode table, returning NULL if out of memory
+static struct hfsfuse_inode* hfsfuse_ll_ref(struct hfsfuse_ll* ll, const hfs_catalog_keyed_record_t* rec, uint8_t fork, hfs_cnid_t parent_cnid) {
+	uint64_t key = (uint64_t)fork << 32 | rec->file.cnid;
+	struct hfsfuse_inode* inode;
+	pthread_mutex_lock(&ll->lock);
+	HASH_FIND(hash,ll->inodes,&key,sizeof(key),inode);
+	if(!inode && (inode = malloc(sizeof(*inode)))) {
+		inode->key = key;
+		inode->nlookup = 0;
+		inode->record = *rec;
+		inode->fork = fork;
+		inode->parent_cnid = parent_cnid;
+		HASH_ADD(hash,ll->inodes,key,sizeof(inode->key),inode);
+	}
+	if(inode)
+		inode->nlookup++;
+	pthread_mutex_unlock(&ll->lock);
+	return inode;
+}
+
+static void hfsfuse_ll_unref(struct hfsfuse_ll* ll, fuse_ino_t ino, uint64_t nlookup) {
+	if(ino == FUSE_ROOT_ID)
+		return;
+	struct hfsfuse_inode* inode = hfsfuse_ll_inode(ll,ino);
+	pthread_mutex_lock(&ll->lock);
+	if(!(inode->nlookup -= nlookup)) {
+		HASH_DELETE(hash,ll->inodes,inode);
+		free(inode);
+	}
+	pthread_mutex_unlock(&ll->lock);
+}
+
+static void hfsfuse_ll_destroy(void* userdata) {
+	struct hfsfuse_ll* ll = userdata;
+	struct hfsfuse_inode* inode,* tmp;
+	HASH_ITER(hash,ll->inodes,inode,tmp) {
+		HASH_DELETE(hash,ll->inodes,inode);
+		free(inode);
+	}
+	hfslib_close_volume(ll->vol, NULL);
+}
+
+static void hfsfuse_ll_lookup(fuse_req_t req, fuse_ino_t parent, const char* name) {
+	struct hfsfuse_ll* ll = fuse_req_userdata(req);
+	struct hfsfuse_inode* dir = hfsfuse_ll_inode(ll,parent);
+	if(dir->record.type != HFS_REC_FLDR) {
+		fuse_reply_err(req,ENOTDIR);
+		return;
+	}
+
+	hfs_catalog_keyed_record_t rec;
+	uint8_t fork;
+	int ret = hfs_lookup_child(ll->vol,dir->record.folder.cnid,name,&rec,&fork);
+	if(ret == -ENOENT && hfsfuse_timeouts.negative > 0) {
+		// an entry with inode 0 lets the kernel remember the name doesn't exist
+		fuse_reply_entry(req,&(struct fuse_entry_param){ .entry_timeout = hfsfuse_timeouts.negative });
+		return;
+	}
+	if(ret) {
+		fuse_reply_err(req,-ret);
+		return;
+	}
+
+	struct hfsfuse_inode* inode = hfsfuse_ll_ref(ll,&rec,fork,dir->record.folder.cnid);
+	if(!inode) {
+		fuse_reply_err(req,ENOMEM);
+		return;
+	}
+
+	struct fuse_entry_param e = {
+		.ino = (fuse_ino_t)(uintptr_t)inode,
+		.attr_timeout = hfsfuse_timeouts.attr,
+		.entry_timeout = hfsfuse_timeouts.entry,
+	};
+	hfs_stat(ll->vol,&inode->record,&e.attr,inode->fork);
+	if(fuse_reply_entry(req,&e))
+		hfsfuse_ll_unref(ll,e.ino,1);
+}
+
+static void hfsfuse_ll_forget(fuse_req_t req, fuse_ino_t ino, uint64_t nlookup) {
+	hfsfuse_ll_unref(fuse_req_userdata(req),ino,nlookup);
+	fuse_reply_none(req);
+}
+
+static void hfsfuse_ll_forget_multi(fuse_req_t req, size_t count, struct fuse_forget_data* forgets) {
+	for(size_t i = 0; i < count; i++)
+		hfsfuse_ll_unref(fuse_req_userdata(req),forgets[i].ino,forgets[i].nlookup);
+	fuse_reply_none(req);
+}
+
+static void hfsfuse_ll_getattr(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info* info) {
+	struct hfsfuse_ll* ll = fuse_req_userdata(req);
+	struct hfsfuse_inode* inode = hfsfuse_ll_inode(ll,ino);
+	struct stat st;
+	hfs_stat(ll->vol,&inode->record,&st,inode->fork);
+	fuse_reply_attr(req,&st,hfsfuse_timeouts.attr);
+}
+
+static void hfsfuse_ll_readlink(fuse_req_t req, fuse_ino_t ino) {
+	struct hfsfuse_ll* ll = fuse_req_userdata(req);
+	struct hfsfuse_inode* inode = hfsfuse_ll_inode(ll,ino);
+	int ret;
+	struct hfs_file* f = hfs_file_open(ll->vol,&inode->record,inode->fork,&ret);
+	if(!f) {
+		fuse_reply_err(req,-ret);
+		return;
+	}
+
+	char buf[PATH_MAX];
+	ssize_t bytes = hfs_file_read(f,buf,sizeof(buf)-1);
+	hfs_file_close(f);
+	if(bytes < 0) {
+		fuse_reply_err(req,-bytes);
+		return;
+	}
+	buf[bytes] = '\0';
+	fuse_reply_readlink(req,buf);
+}
+
+static void hfsfuse_ll_open(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info* info) {
+	struct hfsfuse_ll* ll = fuse_req_userdata(req);
+	struct hfsfuse_inode* inode = hfsfuse_ll_inode(ll,ino);
+	int ret = hfsfuse_file_open(ll->vol,NULL,&inode->record,inode->fork,info);
+	if(ret)
+		fuse_reply_err(req,-ret);
+	else if(fuse_reply_open(req,info))
+		hfsfuse_file_close((struct hfsfuse_file*)info->fh);
+}
+
+static void hfsfuse_ll_release(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info* info) {
+	fuse_reply_err(req,-hfsfuse_file_close((struct hfsfuse_file*)info->fh));
+}
+
+static void hfsfuse_ll_read(fuse_req_t req, fuse_ino_t ino, size_t size, off_t offset, struct fuse_file_info* info) {
+	char* buf = malloc(size);
+	if(!buf) {
+		fuse_reply_err(req,ENOMEM);
+		return;
+	}
+	ssize_t bytes = hfsfuse_file_pread((struct hfsfuse_file*)info->fh,buf,size,offset);
+	if(bytes < 0)
+		fuse_reply_err(req,-bytes);
+	else fuse_reply_buf(req,buf,bytes);
+	free(buf);
+}
+
+static void hfsfuse_ll_opendir(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info* info) {
+	struct hfsfuse_ll* ll = fuse_req_userdata(req);
+	struct hfsfuse_inode* inode = hfsfuse_ll_inode(ll,ino);
+	if(inode->record.type != HFS_REC_FLDR) {
+		fuse_reply_err(req,ENOTDIR);
+		return;
+	}
+
+	struct hfsfuse_dir* d;
+	int ret = hfsfuse_dir_open(ll->vol,&inode->record,inode->parent_cnid,NULL,&d);
+	if(ret) {
+		fuse_reply_err(req,-ret);
+		return;
+	}
+	info->fh = (uint64_t)d;
+#if HFSFUSE_CACHE_READDIR
+	info->cache_readdir = 1;
+	info->keep_cache = 1;
+#endif
+	if(fuse_reply_open(req,info))
+		hfsfuse_dir_close(ll->vol,d);
+}
+
+struct hfsfuse_ll_dirbuf {
+	fuse_req_t req;
+	char* buf;
+	size_t size, used;
+};
+
+// a fill_dir_type for hfsfuse_dir_fill that adds entries to a readdir reply
+static int hfsfuse_ll_fill(void* buf, const char* name, const struct stat* st, off_t offset, enum fuse_fill_dir_flags flags) {
+	struct hfsfuse_ll_dirbuf* b = buf;
+	// only the root's ".." comes without attributes, and the root is its own parent
+	struct stat root = { .st_ino = HFS_CNID_ROOT_FOLDER, .st_mode = S_IFDIR };
+	size_t len = fuse_add_direntry(b->req,b->buf+b->used,b->size-b->used,name,st ? st : &root,offset);
+	if(len > b->size-b->used)
+		return 1;
+	b->used += len;
+	return 0;
+}
+
+// there's no readdirplus, as each entry it returned would need its full record added to the inode table
+static void hfsfuse_ll_readdir(fuse_req_t req, fuse_ino_t ino, size_t size, off_t offset, struct fuse_file_info* info) {
+	struct hfsfuse_ll* ll = fuse_req_userdata(req);
+	struct hfsfuse_ll_dirbuf b = { .req = req, .buf = malloc(size), .size = size };
+	if(!b.buf) {
+		fuse_reply_err(req,ENOMEM);
+		return;
+	}
+	int ret = hfsfuse_dir_fill(ll->vol,(struct hfsfuse_dir*)info->fh,&b,hfsfuse_ll_fill,offset,false);
+	if(ret)
+		fuse_reply_err(req,-ret);
+	else fuse_reply_buf(req,b.buf,b.used);
+	free(b.buf);
+}
+
+static void hfsfuse_ll_releasedir(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info* info) {
+	struct hfsfuse_ll* ll = fuse_req_userdata(req);
+	fuse_reply_err(req,-hfsfuse_dir_close(ll->vol,(struct hfsfuse_dir*)info->fh));
+}
+
+static void hfsfuse_ll_statfs(fuse_req_t req, fuse_ino_t ino) {
+	struct hfsfuse_ll* ll = fuse_req_userdata(req);
+	struct statvfs st = {0};
+	hfsfuse_statvfs(ll->vol,&st);
+	fuse_reply_statfs(req,&st);
+}
+
+// ret is the attribute's size or negative errno, with the value in buf if size isn't 0
+static void hfsfuse_ll_reply_xattr(fuse_req_t req, int ret, const char* buf, size_t size) {
+	if(ret < 0)
+		fuse_reply_err(req,-ret);
+	else if(!size)
+		fuse_reply_xattr(req,ret);
+	else if((size_t)ret > size)
+		fuse_reply_err(req,ERANGE);
+	else fuse_reply_buf(req,buf,ret);
+}
+
+static void hfsfuse_ll_listxattr(fuse_req_t req, fuse_ino_t ino, size_t size) {
+	struct hfsfuse_ll* ll = fuse_req_userdata(req);
+	char* buf = NULL;
+	if(size && !(buf = malloc(size))) {
+		fuse_reply_err(req,ENOMEM);
+		return;
+	}
+	hfsfuse_ll_reply_xattr(req,hfsfuse_listxattr_record(ll->vol,&hfsfuse_ll_inode(ll,ino)->record,buf,size),buf,size);
+	free(buf);
+}
+
+static void hfsfuse_ll_getxattr(fuse_req_t req, fuse_ino_t ino, const char* attr, size_t size) {
+	struct hfsfuse_ll* ll = fuse_req_userdata(req);
+	char* buf = NULL;
+	if(size && !(buf = malloc(size))) {
+		fuse_reply_err(req,ENOMEM);
+		return;
+	}
+	hfsfuse_ll_reply_xattr(req,hfsfuse_getxattr_record(ll->vol,&hfsfuse_ll_inode(ll,ino)->record,attr,buf,size,0),buf,size);
+	free(buf);
+}
+
+static struct fuse_lowlevel_ops hfsfuse_ll_ops = {
+	.destroy      = hfsfuse_ll_destroy,
+	.lookup       = hfsfuse_ll_lookup,
+	.forget       = hfsfuse_ll_forget,
+	.forget_multi = hfsfuse_ll_forget_multi,
+	.getattr      = hfsfuse_ll_getattr,
+	.readlink     = hfsfuse_ll_readlink,
+	.open         = hfsfuse_ll_open,
+	.read         = hfsfuse_ll_read,
+	.release      = hfsfuse_ll_release,
+	.opendir      = hfsfuse_ll_opendir,
+	.readdir      = hfsfuse_ll_readdir,
+	.releasedir   = hfsfuse_ll_releasedir,
+	.statfs       = hfsfuse_ll_statfs,
+	.listxattr    = hfsfuse_ll_listxattr,
+	.getxattr     = hfsfuse_ll_getxattr,
+};
+
+// mounts and serves vol as fuse_main would for the high level API
+static int hfsfuse_ll_main(struct fuse_args* args, hfs_volume* vol) {
+	struct hfsfuse_ll ll = { .vol = vol };
+	hfs_catalog_key_t key;
+	if(hfslib_find_catalog_record_with_cnid(vol,HFS_CNID_ROOT_FOLDER,&ll.root.record,&key,NULL)) {
+		fprintf(stderr,"Couldn't find the root folder\n");
+		return 1;
+	}
+	ll.root.fork = HFS_DATAFORK;
+	ll.root.parent_cnid = key.parent_cnid;
+
+	struct fuse_cmdline_opts opts;
+	if(fuse_parse_cmdline(args,&opts))
+		return 1;
+
+	int ret = 1;
+	if(!opts.mountpoint) {
+		fprintf(stderr,"No mountpoint specified\n");
+		goto end;
+	}
+	if(pthread_mutex_init(&ll.lock,NULL))
+		goto end;
+
+	struct fuse_session* se = fuse_session_new(args,&hfsfuse_ll_ops,sizeof(hfsfuse_ll_ops),&ll);
+	if(!se)
+		goto lock;
+	if(fuse_set_signal_handlers(se))
+		goto session;
+	if(fuse_session_mount(se,opts.mountpoint))
+		goto handlers;
+
+	fuse_daemonize(opts.foreground);
+	if(opts.singlethread)
+		ret = fuse_session_loop(se);
+	else {
+#if FUSE_VERSION >= 32
+		struct fuse_loop_config config = {
+			.clone_fd = opts.clone_fd,
+			.max_idle_threads = opts.max_idle_threads,
+		};
+		ret = fuse_session_loop_mt(se,&config);
+#else
+		ret = fuse_session_loop_mt(se,opts.clone_fd);
+#endif
+	}
+	ret = ret != 0;
+
+	fuse_session_unmount(se);
+handlers:
+	fuse_remove_signal_handlers(se);
+session:
+	fuse_session_destroy(se);
+lock:
+	pthread_mutex_destroy(&ll.lock);
+end:
+	free(opts.mountpoint);
+	return ret;
+}
+#endif
+
 enum {
 	HFSFUSE_OPT_KEY_HELP,
 	HFSFUSE_OPT_KEY_FULLHELP,
@@ -747,6 +1335,9 @@ struct hfsfuse_config {
 	char* device;
 	int allow_other_set;
 	int force;
+	int readdirplus;
+	int lowlevel;
+	struct hfsfuse_timeouts timeouts;
 };
 
 #define HFS_OPTION(t, p) { t, offsetof(struct hfs_volume_config, p), 1 }
@@ -760,12 +1351,28 @@ static struct fuse_opt hfsfuse_opts[] = {
 	FUSE_OPT_KEY("--version", HFSFUSE_OPT_KEY_VERSION),
 	HFSFUSE_OPTION("--force",force),
 	HFSFUSE_OPTION("allow_other",allow_other_set),
+	{ "readdirplus=auto", offsetof(struct hfsfuse_config, readdirplus), HFSFUSE_READDIRPLUS_AUTO },
+	{ "readdirplus=no", offsetof(struct hfsfuse_config, readdirplus), HFSFUSE_READDIRPLUS_NO },
+	{ "readdirplus=yes", offsetof(struct hfsfuse_config, readdirplus), HFSFUSE_READDIRPLUS_YES },
+#if HFSFUSE_LOWLEVEL
+	HFSFUSE_OPTION("lowlevel",lowlevel),
+#endif
+	HFSFUSE_OPTION("entry_timeout=%lf",timeouts.entry),
+	HFSFUSE_OPTION("attr_timeout=%lf",timeouts.attr),
+	HFSFUSE_OPTION("negative_timeout=%lf",timeouts.negative),
 	FUSE_OPT_KEY("noallow_other",HFSFUSE_OPT_KEY_NOALLOW_OTHER),
 	HFS_OPTION("cache_size=%zu",cache_size),
+	HFS_OPTION("dentry_cache_size=%zu",dentry_cache_size),
+	HFS_OPTION("neg_cache_size=%zu",negative_cache_size),
+	HFS_OPTION("node_cache_size=%zu",node_cache_size),
+	HFS_OPTION("dir_cache_size=%zu",dir_cache_size),
+	HFS_OPTION("dir_cache_mem=%zu",dir_cache_max_bytes),
+	HFS_OPTION("cmp_cache_size=%zu",decmpfs_cache_size),
 	HFS_OPTION("blksize=%" SCNu32,blksize),
 	HFS_OPTION("noublio", noublio),
 	HFS_OPTION("ublio_items=%" SCNd32, ublio_items),
 	HFS_OPTION("ublio_grace=%" SCNu64,ublio_grace),
+	HFS_OPTION("io_uring",io_uring),
 	HFS_OPTION("rsrc_ext=%s",rsrc_suff),
 	HFS_OPTION("rsrc_only",rsrc_only),
 	HFS_OPTION("default_file_mode=%" SCNo16,default_file_mode),
@@ -794,6 +1401,17 @@ static void help(const char* self, struct hfsfuse_config* cfg) {
 		"    --force                force mount volumes with dirty journal\n"
 		"    -o rsrc_only           only mount the resource forks of files\n"
 		"    -o cache_size=N        size of lookup cache (%zu)\n"
+		"    -o dentry_cache_size=N number of path components to cache, 0 to disable (%zu)\n"
+		"    -o neg_cache_size=N    number of nonexistent names to remember, 0 to disable (%zu)\n"
+		"    -o node_cache_size=N   number of B-tree nodes to cache, 0 to disable (%zu)\n"
+		"    -o dir_cache_size=N    number of directory listings to cache, 0 to disable (%zu)\n"
+		"    -o dir_cache_mem=N     maximum bytes of memory used by cached directory listings (%zu)\n"
+		"    -o cmp_cache_size=N    number of compression headers to cache, 0 to disable (%zu)\n"
+		"    -o readdirplus=MODE    return attributes with directory listings: yes, no,\n"
+		"                           or auto to leave it to the kernel (auto)\n"
+		"    -o entry_timeout=T     seconds the kernel may cache name lookups (%.0f)\n"
+		"    -o attr_timeout=T      seconds the kernel may cache attributes (%.0f)\n"
+		"    -o negative_timeout=T  seconds the kernel may cache nonexistent names (%.0f)\n"
 		"    -o blksize=N           set a custom read size/alignment in bytes\n"
 		"                           you should only set this if you are sure it is being misdetected\n"
 		"    -o rsrc_ext=suffix     special suffix for filenames which can be used to access their resource fork\n"
@@ -808,6 +1426,15 @@ static void help(const char* self, struct hfsfuse_config* cfg) {
 		"                           of these on systems that don't support symlink xattrs\n"
 		"\n",
 		cfg->volume_config.cache_size,
+		cfg->volume_config.dentry_cache_size,
+		cfg->volume_config.negative_cache_size,
+		cfg->volume_config.node_cache_size,
+		cfg->volume_config.dir_cache_size,
+		cfg->volume_config.dir_cache_max_bytes,
+		cfg->volume_config.decmpfs_cache_size,
+		cfg->timeouts.entry,
+		cfg->timeouts.attr,
+		cfg->timeouts.negative,
 		cfg->volume_config.default_file_mode,
 		cfg->volume_config.default_dir_mode,
 		cfg->volume_config.default_uid,
@@ -824,6 +1451,20 @@ static void help(const char* self, struct hfsfuse_config* cfg) {
 			cfg->volume_config.ublio_grace
 		);
 	}
+	if(hfs_get_lib_features() & HFS_LIB_FEATURES_IO_URING)
+		fputs(
+			"    -o io_uring            read file data in batches through io_uring, bypassing ublio\n"
+			"\n",
+			stdout
+		);
+#if HFSFUSE_LOWLEVEL
+	fputs(
+		"    -o lowlevel            find files by inode number with the FUSE low-level API rather than by path\n"
+		"                           directory listings are returned without attributes in this mode\n"
+		"\n",
+		stdout
+	);
+#endif
 }
 
 static void version(void) {
@@ -841,14 +1482,14 @@ static void version(void) {
 
 	if(hfs_get_lib_features() & HFS_LIB_FEATURES_UBLIO)
 		fprintf(stderr, "    ublio v%s\n", hfs_lib_ublio_version());
-	if(hfs_get_lib_features() & HFS_LIB_FEATURES_UTF8PROC)
-		fprintf(stderr, "    utf8proc v%s\n", hfs_lib_utf8proc_version());
 	if(hfs_get_lib_features() & HFS_LIB_FEATURES_ZLIB)
 		fprintf(stderr, "    zlib v%s\n", hfs_lib_zlib_version());
 	if(hfs_get_lib_features() & HFS_LIB_FEATURES_LZFSE)
 		fprintf(stderr, "    LZFSE\n");
 	if(hfs_get_lib_features() & HFS_LIB_FEATURES_LZVN)
 		fprintf(stderr, "    LZVN\n");
+	if(hfs_get_lib_features() & HFS_LIB_FEATURES_IO_URING)
+		fprintf(stderr, "    io_uring\n");
 }
 
 #if FUSE_VERSION < 28 || defined(__HAIKU__)
@@ -936,6 +1577,7 @@ int main(int argc, char* argv[]) {
 
 	struct hfsfuse_config cfg = {0};
 	hfs_volume_config_defaults(&cfg.volume_config);
+	cfg.timeouts.entry = cfg.timeouts.attr = cfg.timeouts.negative = HFSFUSE_TIMEOUT_DEFAULT;
 
 	int ret = 1;
 	if(fuse_opt_parse(&args, &cfg, hfsfuse_opts, hfsfuse_opt_proc) == -1)
@@ -969,6 +1611,12 @@ int main(int argc, char* argv[]) {
 		fuse_opt_add_opt(&opts, "allow_other");
 #if FUSE_VERSION < 30
 	fuse_opt_add_opt(&opts, "use_ino");
+#ifndef __HAIKU__
+	char timeouts[128];
+	snprintf(timeouts, sizeof(timeouts), "entry_timeout=%g,attr_timeout=%g,negative_timeout=%g",
+	         cfg.timeouts.entry, cfg.timeouts.attr, cfg.timeouts.negative);
+	fuse_opt_add_opt(&opts, timeouts);
+#endif
 #endif
 	fuse_opt_add_opt(&opts, "subtype=hfs");
 	hfsfuse_opt_add_opt_escaped(&opts, fsname);
@@ -995,7 +1643,14 @@ int main(int argc, char* argv[]) {
 			goto done;
 		}
 	}
+	hfsfuse_readdirplus = cfg.readdirplus;
+	hfsfuse_timeouts = cfg.timeouts;
 	hfs_gcb.error = hfs_vsyslog; // prepare to daemonize
+#if HFSFUSE_LOWLEVEL
+	if(cfg.lowlevel)
+		ret = hfsfuse_ll_main(&args, &vol);
+	else
+#endif
 	ret = fuse_main(args.argc, args.argv, &hfsfuse_ops, &vol);
 
 done:
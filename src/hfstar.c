@@ -121,7 +121,7 @@ static void hfstar_write_automatic_xattrs(struct hfstar_archive_context* ctx, co
 
 	if(!ctx->rsrc_ext && rec->type == HFS_REC_FILE && rec->file.rsrc_fork.logical_size && !compressed) {
 		hfs_extent_descriptor_t* extents = NULL;
-		uint16_t nextents = hfslib_get_file_extents(ctx->vol,rec->file.cnid,HFS_RSRCFORK,&extents,NULL);
+		uint16_t nextents = hfslib_get_fork_extents(ctx->vol,rec->file.cnid,HFS_RSRCFORK,&rec->file.rsrc_fork,&extents,NULL);
 		if(nextents) {
 			uint64_t bytes = 0;
 			char* data = malloc(rec->file.rsrc_fork.logical_size);
@@ -202,7 +202,7 @@ static void hfstar_write_symlink(struct hfstar_archive_context* ctx, const char*
 	}
 
 	hfs_extent_descriptor_t* extents = NULL;
-	uint16_t nextents = hfslib_get_file_extents(ctx->vol,rec->file.cnid,HFS_DATAFORK,&extents,NULL);
+	uint16_t nextents = hfslib_get_fork_extents(ctx->vol,rec->file.cnid,HFS_DATAFORK,&rec->file.data_fork,&extents,NULL);
 	uint64_t bytes = 0;
 	if(!(ctx->hfs_err = hfslib_readd_with_extents(ctx->vol,dest,&bytes,rec->file.data_fork.logical_size+1,0,extents,nextents,NULL)) && bytes) {
 		dest[rec->file.data_fork.logical_size] = '\0';
@@ -477,13 +477,15 @@ static void hfstar_archive_records(struct hfstar_archive_context* ctx, const cha
 				goto dirent_end;
 		}
 		if(cur->rec.type == HFS_REC_FLDR) {
-			hfs_catalog_keyed_record_t* recs = NULL;
-			hfs_unistr255_t* names = NULL;
-			uint32_t entries = 0;
+			hfs_dir_cursor_t cursor;
+			hfs_catalog_keyed_record_t rec;
+			hfs_catalog_key_t key;
+			int read_err;
 
-			ctx->hfs_err = hfslib_get_directory_contents(ctx->vol,cur->rec.folder.cnid,&recs,&names,&entries,NULL);
-			for(uint32_t i = 0; i < entries; i++) {
-				struct hfstar_dirent* next = malloc(sizeof(*next)+cur->pathlen+1+names[i].length*3+1);
+			if((ctx->hfs_err = hfslib_open_directory(ctx->vol,cur->rec.folder.cnid,&cursor,NULL)))
+				goto dirent_end;
+			while(!(read_err = hfslib_read_directory(ctx->vol,&cursor,&rec,&key,NULL))) {
+				struct hfstar_dirent* next = malloc(sizeof(*next)+cur->pathlen+1+key.name.length*3+1);
 				if(!next) {
 					ctx->hfs_err = -ENOMEM;
 					break;
@@ -494,9 +496,9 @@ static void hfstar_archive_records(struct hfstar_archive_context* ctx, const cha
 				if(next->pathlen && next->path[next->pathlen-1] != '/')
 					next->path[next->pathlen++] = '/';
 
-				ssize_t len = hfs_pathname_to_unix(names+i,next->path+next->pathlen);
+				ssize_t len = hfs_pathname_to_unix(&key.name,next->path+next->pathlen);
 				if((ctx->hfs_err = len <= 0)) {
-					fprintf(stderr,"Error converting path for CNID %" PRIu32 ": %zd\n",recs[i].file.cnid,len);
+					fprintf(stderr,"Error converting path for CNID %" PRIu32 ": %zd\n",rec.file.cnid,len);
 					free(next);
 					if(ctx->stop_on_error)
 						break;
@@ -504,11 +506,12 @@ static void hfstar_archive_records(struct hfstar_archive_context* ctx, const cha
 				}
 
 				next->pathlen += len;
-				memcpy(&next->rec,recs+i,sizeof(hfs_catalog_keyed_record_t));
+				memcpy(&next->rec,&rec,sizeof(hfs_catalog_keyed_record_t));
 				STACK_PUSH(stack,next);
 			}
-			free(recs);
-			free(names);
+			if(read_err > 0)
+				ctx->hfs_err = read_err;
+			hfslib_close_directory(ctx->vol,&cursor,NULL);
 		}
 
 dirent_end:
@@ -550,14 +553,14 @@ static void version(void) {
 
 	if(hfs_get_lib_features() & HFS_LIB_FEATURES_UBLIO)
 		fprintf(stderr, "    ublio v%s\n", hfs_lib_ublio_version());
-	if(hfs_get_lib_features() & HFS_LIB_FEATURES_UTF8PROC)
-		fprintf(stderr, "    utf8proc v%s\n", hfs_lib_utf8proc_version());
 	if(hfs_get_lib_features() & HFS_LIB_FEATURES_ZLIB)
 		fprintf(stderr, "    zlib v%s\n", hfs_lib_zlib_version());
 	if(hfs_get_lib_features() & HFS_LIB_FEATURES_LZFSE)
 		fprintf(stderr, "    LZFSE\n");
 	if(hfs_get_lib_features() & HFS_LIB_FEATURES_LZVN)
 		fprintf(stderr, "    LZVN\n");
+	if(hfs_get_lib_features() & HFS_LIB_FEATURES_IO_URING)
+		fprintf(stderr, "    io_uring\n");
 
 	exit(0);
 }
@@ -618,6 +621,11 @@ static void help(struct hfs_volume_config* cfg) {
 			cfg->ublio_grace
 		);
 	}
+	if(hfs_get_lib_features() & HFS_LIB_FEATURES_IO_URING)
+		printf(
+			"  --io-uring         Read file data in batches through io_uring, bypassing ublio.\n"
+			"\n"
+		);
 	exit(0);
 }
 
@@ -648,6 +656,7 @@ int main(int argc, char* argv[]) {
 		{"noublio",no_argument,&cfg.noublio,1},
 		{"ublio-items",required_argument,NULL,10},
 		{"ublio-grace",required_argument,NULL,11},
+		{"io-uring",no_argument,&cfg.io_uring,1},
 	};
 
 	int c;
@@ -699,6 +708,8 @@ int main(int argc, char* argv[]) {
 	hfs_catalog_keyed_record_t root_rec;
 
 	cfg.cache_size = 0;
+	cfg.dentry_cache_size = 0;
+	cfg.negative_cache_size = 0;
 
 	if((ctx.hfs_err = hfs_open_volume(argv[0],ctx.vol,&cfg))) {
 		log_hfs_err(&ctx,"Couldn't open volume '%s'",argv[0]);